@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+
+#include "board-batch.h"
+#include "bot.h"
+#include "fixtures.h"
+#include "game.h"
+#include "move-generator.h"
+
+// --- Collision Benchmarks ---
+
+static void BM_IsShapeIntersecting(benchmark::State &state) {
+    const auto game = make_fixture_game(static_cast<Fixture>(state.range(0)));
+
+    // Probe every in-bounds position of every rotation of every shape
+    for (auto _ : state) {
+        int hits = 0;
+        for (unsigned int type = 0; type < SHAPE_COUNT; ++type) {
+            Shape shape(type);
+            for (int rotation = 0; rotation < SHAPE_ROTATIONS; ++rotation, shape = shape.rotated_clockwise()) {
+                const auto size = shape.get_size();
+                for (int y = 0; y + size.y <= GAME_GRID_HEIGHT; ++y) {
+                    for (int x = 0; x + size.x <= GAME_GRID_WIDTH; ++x) { hits += game.is_shape_intersecting(shape, Vec2(x, y)); }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_IsShapeIntersecting) FIXTURE_ARGS;
+
+static void BM_UpdateLandingPosition(benchmark::State &state) {
+    auto game = make_fixture_game(static_cast<Fixture>(state.range(0)));
+
+    for (auto _ : state) {
+        game.update_landing_position();
+        benchmark::DoNotOptimize(game.get_landing_position());
+    }
+}
+BENCHMARK(BM_UpdateLandingPosition) FIXTURE_ARGS;
+
+// --- Line Clear Benchmarks ---
+
+static void BM_RemoveFilledLines(benchmark::State &state) {
+    const auto lines = static_cast<int>(state.range(0));
+
+    // Half-full board with the requested number of full rows at the bottom
+    auto grid = make_fixture_grid(Fixture::HalfFull);
+    for (int y = GAME_GRID_HEIGHT - lines; y < GAME_GRID_HEIGHT; ++y) { for (int x = 0; x < GAME_GRID_WIDTH; ++x) { grid(x, y) = 1; } }
+
+    auto game = make_fixture_game(Fixture::Empty);
+
+    // Resetting the grid is part of every iteration, the 0 lines case is its baseline
+    for (auto _ : state) {
+        game.set_grid(grid);
+        benchmark::DoNotOptimize(game.remove_filled_lines(GAME_GRID_HEIGHT - BITBOARD_SHAPE_ROWS, BITBOARD_SHAPE_ROWS));
+        benchmark::DoNotOptimize(game.get_occupancy());
+    }
+}
+BENCHMARK(BM_RemoveFilledLines)->DenseRange(0, 4);
+
+// --- Game Cycle Benchmarks ---
+
+static void BM_PlaceAndNextShape(benchmark::State &state) {
+    const auto  states = make_fixture_states(static_cast<Fixture>(state.range(0)));
+    Game        game;
+    std::size_t next = 0;
+
+    // Restoring a state is a single copy, measured alone by BM_GameCopy
+    for (auto _ : state) {
+        game.restore(states[next]);
+        next = next + 1 < states.size() ? next + 1 : 0;
+
+        game.land_shape();
+        game.place_shape();
+        benchmark::DoNotOptimize(game.next_shape());
+    }
+}
+BENCHMARK(BM_PlaceAndNextShape) FIXTURE_ARGS;
+
+static void BM_HardDrop(benchmark::State &state) {
+    const auto  states = make_fixture_states(static_cast<Fixture>(state.range(0)));
+    Game        game;
+    std::size_t next = 0;
+
+    for (auto _ : state) {
+        game.restore(states[next]);
+        next = next + 1 < states.size() ? next + 1 : 0;
+
+        benchmark::DoNotOptimize(game.apply(Action::HardDrop));
+    }
+}
+BENCHMARK(BM_HardDrop) FIXTURE_ARGS;
+
+static void BM_GameCopy(benchmark::State &state) {
+    const auto game = make_fixture_game(Fixture::HalfFull);
+
+    for (auto _ : state) {
+        auto copy = game;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_GameCopy);
+
+// --- Bot Benchmarks ---
+
+static void BM_MoveGenerate(benchmark::State &state) {
+    const auto game  = make_fixture_game(static_cast<Fixture>(state.range(0)));
+    const auto board = game.get_occupancy();
+
+    MoveGenerator generator;
+    std::int64_t  placements = 0;
+    for (auto _ : state) {
+        // Every shape from its spawn position
+        for (unsigned int type = 0; type < SHAPE_COUNT; ++type) {
+            Shape shape(type);
+            shape.position = shape.get_spawn_position();
+            placements += generator.generate(board, shape);
+        }
+        benchmark::DoNotOptimize(generator);
+    }
+    state.SetItemsProcessed(state.iterations() * SHAPE_COUNT);
+    state.counters["placements"] = benchmark::Counter(static_cast<double>(placements) / SHAPE_COUNT, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_MoveGenerate) FIXTURE_ARGS;
+
+static void BM_BotFindMove(benchmark::State &state) {
+    const auto game = make_fixture_game(static_cast<Fixture>(state.range(0)));
+    Bot        bot;
+
+    for (auto _ : state) { benchmark::DoNotOptimize(bot.find_move(game)); }
+    state.counters["placements/s"] = benchmark::Counter(static_cast<double>(bot.get_evaluated()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BotFindMove) FIXTURE_ARGS;
+// Independent searches on every thread, the candidate lists come from per-thread arenas instead of the shared heap
+BENCHMARK(BM_BotFindMove)->Arg(static_cast<int>(Fixture::HalfFull))->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_BoardBatchCompute(benchmark::State &state) {
+    const auto kernel = static_cast<BatchKernel>(state.range(0));
+    if (!BoardBatch::is_supported(kernel)) {
+        state.SkipWithError("kernel not supported");
+        return;
+    }
+    state.SetLabel(BoardBatch::get_kernel_name(kernel));
+
+    const auto board = Bitboard::from_grid(make_fixture_grid(Fixture::HalfFull));
+    BoardBatch batch;
+    while (!batch.is_full()) { batch.add(board, 0); }
+
+    BoardBatchFeatures features;
+    for (auto _ : state) {
+        batch.compute(features, kernel);
+        benchmark::DoNotOptimize(features);
+    }
+    state.SetItemsProcessed(state.iterations() * BOARD_BATCH_SIZE);
+}
+BENCHMARK(BM_BoardBatchCompute)->DenseRange(static_cast<int>(BatchKernel::Scalar), static_cast<int>(BatchKernel::Avx2));
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include "random.h"
+
+// --- Generator Benchmarks ---
+
+template<typename Engine>
+static void BM_EngineNext(benchmark::State &state) {
+    Engine engine(1);
+
+    for (auto _ : state) { benchmark::DoNotOptimize(engine()); }
+}
+BENCHMARK(BM_EngineNext<std::mt19937>);
+BENCHMARK(BM_EngineNext<Xoshiro256>);
+
+static void BM_EngineSeed(benchmark::State &state) {
+    std::uint64_t seed = 0;
+
+    for (auto _ : state) {
+        Xoshiro256 engine(seed++);
+        benchmark::DoNotOptimize(engine);
+    }
+}
+BENCHMARK(BM_EngineSeed);
+
+// --- Bag Benchmarks ---
+
+static void BM_ShuffleBagStd(benchmark::State &state) {
+    std::mt19937                engine(1);
+    std::array<unsigned int, 7> bag = {0, 1, 2, 3, 4, 5, 6};
+
+    for (auto _ : state) {
+        std::shuffle(bag.begin(), bag.end(), engine);
+        benchmark::DoNotOptimize(bag);
+    }
+}
+BENCHMARK(BM_ShuffleBagStd);
+
+static void BM_ShuffleBag(benchmark::State &state) {
+    Xoshiro256                  engine(1);
+    std::array<unsigned int, 7> bag = {0, 1, 2, 3, 4, 5, 6};
+
+    for (auto _ : state) {
+        Random::shuffle(bag.begin(), bag.end(), engine);
+        benchmark::DoNotOptimize(bag);
+    }
+}
+BENCHMARK(BM_ShuffleBag);
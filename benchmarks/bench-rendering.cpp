@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+#include "ansi-terminal.h"
+#include "broadcast.h"
+#include "fixtures.h"
+#include "renderer.h"
+#include "scene.h"
+#include "session.h"
+
+// --- Scene Benchmarks ---
+
+static void BM_SceneFrame(benchmark::State &state) {
+    auto           game = make_fixture_game(static_cast<Fixture>(state.range(0)));
+    MemoryRenderer renderer(Vec2(80, 24));
+    Scene          scene;
+
+    // A frame where the current shape moves by one pixel, as after a key press
+    bool left = true;
+    for (auto _ : state) {
+        game.apply(left ? Action::Left : Action::Right);
+        left = !left;
+
+        renderer.update();
+        scene.draw(renderer, game);
+        renderer.refresh();
+        benchmark::DoNotOptimize(renderer.get_changed_cells());
+    }
+}
+BENCHMARK(BM_SceneFrame) FIXTURE_ARGS;
+
+static void BM_SceneFrameNull(benchmark::State &state) {
+    auto         game = make_fixture_game(Fixture::HalfFull);
+    NullRenderer renderer;
+    Scene        scene;
+
+    // What the client skips when frames are not shown, the baseline of BM_SceneFrame
+    bool left = true;
+    for (auto _ : state) {
+        game.apply(left ? Action::Left : Action::Right);
+        left = !left;
+
+        if (renderer.is_drawn()) {
+            renderer.update();
+            scene.draw(renderer, game);
+            renderer.refresh();
+        }
+        benchmark::DoNotOptimize(game.get_current_shape());
+    }
+}
+BENCHMARK(BM_SceneFrameNull);
+
+// --- Terminal Benchmarks ---
+
+static void BM_AnsiFullFrame(benchmark::State &state) {
+    const Vec2 size(80, 24);
+
+    // A full redraw of the scene, encoded and written to /dev/null
+    const auto     game = make_fixture_game(Fixture::TallJagged);
+    MemoryRenderer renderer(size);
+    Scene          scene;
+    renderer.update();
+    scene.draw(renderer, game);
+
+    const auto   output = open("/dev/null", O_WRONLY);
+    AnsiTerminal terminal(STDIN_FILENO, output);
+    terminal.resize(size);
+
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        terminal.begin_frame();
+        for (int y = 0; y < size.y; ++y) { terminal.write_span(0, y, &renderer.get_cell(0, y), size.x); }
+        bytes += terminal.get_frame().size();
+        terminal.end_frame();
+    }
+    close(output);
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+BENCHMARK(BM_AnsiFullFrame);
+
+// --- Session Benchmarks ---
+
+static void BM_SessionKeyFrame(benchmark::State &state) {
+    Session session(42);
+    session.consume(session.get_output().size());
+    session.render();
+
+    // What the server does for a key: decode it, apply it, draw and encode the frame, then hand the bytes to a socket
+    bool        left  = true;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        session.consume(session.get_output().size());
+        session.receive(left ? "\x1b[D" : "\x1b[C");
+        left = !left;
+
+        session.render();
+        bytes += session.get_output().size();
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+BENCHMARK(BM_SessionKeyFrame);
+
+static void BM_BroadcastFanout(benchmark::State &state) {
+    Game game;
+    game.init(42);
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    std::vector<Spectator> spectators(static_cast<std::size_t>(state.range(0)));
+    for (auto &spectator : spectators) {
+        spectator.watch(broadcast);
+        spectator.consume(spectator.get_queued_bytes());
+    }
+
+    // One frame encoded, then queued and gathered for every viewer: the sockets aside, what the server does per move
+    iovec vectors[SPECTATOR_IOVECS];
+    bool  left = true;
+    for (auto _ : state) {
+        game.apply(left ? Action::Left : Action::Right);
+        left = !left;
+
+        const auto frame = broadcast.publish(game);
+        for (auto &spectator : spectators) {
+            spectator.offer(frame);
+            benchmark::DoNotOptimize(spectator.gather(vectors, SPECTATOR_IOVECS));
+            spectator.consume(spectator.get_queued_bytes());
+        }
+    }
+
+    state.counters["frames/s"] = benchmark::Counter(static_cast<double>(state.iterations() * spectators.size()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BroadcastFanout)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include "board-matrix.h"
+#include "shape.h"
+
+// --- Rotation Benchmarks ---
+
+static void BM_MatrixRotateClockwise(benchmark::State &state) {
+    BoardMatrix<unsigned char> matrix(3, 2);
+    matrix(0, 0) = 6;
+    matrix(1, 0) = 6;
+    matrix(2, 0) = 6;
+    matrix(1, 1) = 6;
+
+    for (auto _ : state) {
+        matrix = matrix.rotate_clockwise();
+        benchmark::DoNotOptimize(matrix);
+    }
+}
+BENCHMARK(BM_MatrixRotateClockwise);
+
+static void BM_ShapeRotateClockwise(benchmark::State &state) {
+    Shape shape(5);
+
+    for (auto _ : state) {
+        shape = shape.rotated_clockwise();
+        benchmark::DoNotOptimize(shape);
+    }
+}
+BENCHMARK(BM_ShapeRotateClockwise);
+
+// --- Construction Benchmarks ---
+
+static void BM_ShapeConstruction(benchmark::State &state) {
+    unsigned int type = 0;
+
+    for (auto _ : state) {
+        Shape shape(type);
+        benchmark::DoNotOptimize(shape);
+        type = type + 1 == SHAPE_COUNT ? 0 : type + 1;
+    }
+}
+BENCHMARK(BM_ShapeConstruction);
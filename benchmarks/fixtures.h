@@ -0,0 +1,73 @@
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "board-matrix.h"
+#include "configs/constants.h"
+#include "game.h"
+
+// Reproducible boards for the benchmarks. Only raw std::mt19937 output is used
+// (distributions are implementation-defined), so every platform builds the same boards.
+
+enum class Fixture : int {
+    Empty,     // Empty board
+    HalfFull,  // Bottom half filled with random holes
+    TallJagged // Columns of random heights up to the top rows
+};
+
+constexpr unsigned int FIXTURE_SEED   = 0x7E7215; // Seed of the fixture generator
+constexpr std::size_t  FIXTURE_STATES = 64;       // Most states of a game played from a fixture
+
+// Build the color grid of a fixture, never containing a full row
+inline GameGrid make_fixture_grid(const Fixture fixture) {
+    GameGrid     grid;
+    std::mt19937 rng(FIXTURE_SEED);
+
+    switch (fixture) {
+        case Fixture::Empty:
+            break;
+        case Fixture::HalfFull:
+            for (int y = GAME_GRID_HEIGHT / 2; y < GAME_GRID_HEIGHT; ++y) {
+                const auto hole = static_cast<int>(rng() % GAME_GRID_WIDTH);
+                for (int x = 0; x < GAME_GRID_WIDTH; ++x) {
+                    if (x != hole && rng() % 4 != 0) { grid(x, y) = static_cast<unsigned char>(1 + rng() % 7); }
+                }
+            }
+            break;
+        case Fixture::TallJagged:
+            for (int x = 0; x < GAME_GRID_WIDTH; ++x) {
+                // Leave one column low so no row is ever full
+                const auto height = x == GAME_GRID_WIDTH / 2 ? 2 : static_cast<int>(GAME_GRID_HEIGHT / 2 + rng() % (GAME_GRID_HEIGHT / 2 - 4));
+                for (int y = GAME_GRID_HEIGHT - height; y < GAME_GRID_HEIGHT; ++y) { grid(x, y) = static_cast<unsigned char>(1 + rng() % 7); }
+            }
+            break;
+    }
+
+    return grid;
+}
+
+// Build a started game on top of a fixture
+inline Game make_fixture_game(const Fixture fixture) {
+    Game game;
+    game.init(FIXTURE_SEED);
+    game.set_grid(make_fixture_grid(fixture));
+    return game;
+}
+
+// Build the states of a game played by hard drops from a fixture, each with a shape about to be dropped. A drop from
+// any of them spawns the next shape, so cycling through them never tops out and never needs a reset in the timed loop.
+inline std::vector<GameState> make_fixture_states(const Fixture fixture) {
+    auto                   game = make_fixture_game(fixture);
+    std::vector<GameState> states;
+    while (states.size() < FIXTURE_STATES) {
+        const auto state = game.snapshot();
+        game.apply(Action::HardDrop);
+        if (game.is_over()) { break; }
+        states.push_back(state);
+    }
+    return states;
+}
+
+// Register a benchmark once per fixture
+#define FIXTURE_ARGS ->Arg(static_cast<int>(Fixture::Empty))->Arg(static_cast<int>(Fixture::HalfFull))->Arg(static_cast<int>(Fixture::TallJagged))
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "framebuffer.h"
+#include "vec2.h"
+
+constexpr int ANSI_CELL_BYTES  = 32; // Most bytes a cell can take in a frame: cursor move, colors and glyph
+constexpr int ANSI_FRAME_BYTES = 64; // Bytes of the sequences around a frame
+
+constexpr std::string_view ANSI_SCREEN_ENTER = "\x1b[?1049h\x1b[?25l\x1b[0m\x1b[2J"; // Switch to the alternate screen, hide the cursor and clear
+constexpr std::string_view ANSI_SCREEN_LEAVE = "\x1b[0m\x1b[?25h\x1b[?1049l";         // Show the cursor and go back to the main screen
+
+// Encoder of frames as ANSI escape sequences (cursor moves, SGR colors and UTF-8 glyphs) into a buffer preallocated
+// for the whole screen. It only assembles bytes, so a local terminal and a network session share it.
+class AnsiEncoder {
+public:
+    AnsiEncoder() { resize(Vec2(80, 24)); }
+
+    [[nodiscard]] std::string_view get_frame() const { return std::string_view(buffer.data(), length); } // Get the bytes of the frame being assembled
+
+    void set_synchronized(const bool enabled) { synchronized = enabled; } // Wrap frames in synchronized updates (DEC mode 2026)
+    void resize(const Vec2 &size);                                       // Preallocate the buffer for a screen, and forget what it shows
+    void reset();                                                        // Forget the cursor and color of the screen
+
+    void             begin_frame();                                      // Start assembling a frame
+    void             clear_screen();                                     // Append a clear of the whole screen to the frame
+    void             write_span(int x, int y, const Cell *cells, int n); // Append a run of cells to the frame
+    std::string_view end_frame();                                        // Finish the frame, returns its bytes or nothing if no cell changed
+
+private:
+    std::vector<char> buffer       = {};           // Frame bytes, preallocated for a full redraw of the screen
+    std::size_t       length       = 0;            // Number of bytes of the frame being assembled
+    bool              synchronized = true;         // Flag to wrap frames in synchronized updates
+    short             color        = -1;           // Color pair the screen draws with, -1 if unknown
+    Vec2              cursor       = Vec2(-1, -1); // Position of the screen cursor, (-1, -1) if unknown
+
+    void append(std::string_view bytes); // Append raw bytes to the frame
+    void append_number(int value);       // Append a decimal number to the frame
+    void append_glyph(wchar_t glyph);    // Append a character to the frame as UTF-8
+    void set_color(short pair);          // Append the SGR sequence of a color pair if it changed
+};
+
+// Decode the key at the start of input bytes as a KEY_CODE_* or character, and set consumed to its length. Arrows come
+// as CSI (ESC [ A) or SS3 (ESC O A), other sequences are skipped. A sequence cut by the end of the bytes is left
+// for the next read (consumed 0) unless the input is complete, then its escape is a key on its own.
+int decode_ansi_key(const char *bytes, int available, int &consumed, bool complete = true);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ansi-terminal.h"
+#include "renderer.h"
+
+// Renderer drawing with escape sequences, each frame pushed by AnsiTerminal in a single write
+class AnsiRenderer final : public Renderer {
+public:
+    void init() override { terminal.open(); }
+    void terminate() override { terminal.close(); }
+
+    // The decoder may hold keys read with an earlier sequence
+    bool wait_input(const std::chrono::milliseconds timeout) override { return terminal.has_pending_input() || poll_input(terminal.get_input(), timeout); }
+    int  read_key() override { return terminal.read_key(); }
+
+protected:
+    [[nodiscard]] Vec2 query_size() override {
+        terminal.update_size();
+        return terminal.get_size();
+    }
+    int present() override {
+        terminal.begin_frame();
+        const auto changed = frame.flush([this](const int x, const int y, const Cell *cells, const int n) { terminal.write_span(x, y, cells, n); });
+        terminal.end_frame();
+        return changed;
+    }
+
+private:
+    AnsiTerminal terminal; // Terminal the frames are encoded for
+};
+
+// Renderer encoding frames for a remote terminal: each refresh leaves the bytes of its changed cells in memory for
+// the owner to send, and the screen size is whatever the remote side reports
+class StreamRenderer final : public Renderer {
+public:
+    explicit StreamRenderer(const Vec2 &size) : screen_size(size) {}
+
+    void set_size(const Vec2 &new_size) { screen_size = new_size; } // Resize the screen, applied by the next update
+    void forget_screen() { encoder.reset(); }                        // Forget the cursor and color of the screen, the next frame sets both
+
+    [[nodiscard]] std::string_view get_output() const { return output; } // Get the bytes of the last refresh, empty if nothing changed
+
+protected:
+    [[nodiscard]] Vec2 query_size() override { return screen_size; }
+    int                present() override {
+        encoder.begin_frame();
+        const auto changed = frame.flush([this](const int x, const int y, const Cell *cells, const int n) { encoder.write_span(x, y, cells, n); });
+        output             = encoder.end_frame();
+        return changed;
+    }
+    void on_resize() override { encoder.resize(screen_size); }
+
+private:
+    Vec2             screen_size; // Size of the remote screen (in cells)
+    AnsiEncoder      encoder;     // Frame bytes, preallocated for a full redraw of the screen
+    std::string_view output;      // Bytes of the last refresh, inside the encoder buffer
+};
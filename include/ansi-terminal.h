@@ -0,0 +1,80 @@
+#pragma once
+
+#include <csignal>
+#include <iterator>
+#include <string_view>
+#include <termios.h>
+#include <unistd.h>
+
+#include "ansi-encoder.h"
+#include "framebuffer.h"
+#include "vec2.h"
+
+constexpr int ANSI_INPUT_BYTES   = 64;                         // Size of the input read buffer (in bytes)
+constexpr int ANSI_EXIT_SIGNALS[] = {SIGINT, SIGTERM, SIGHUP}; // Signals that end the program, the terminal is restored first
+
+// Terminal driven with ANSI escape sequences, without ncurses. A frame is assembled into a buffer preallocated for
+// the whole screen (cursor moves, SGR colors and UTF-8 glyphs) and pushed with a single write(), wrapped in a
+// synchronized update (DEC mode 2026) so the terminal never shows half a frame.
+class AnsiTerminal {
+public:
+    AnsiTerminal() : AnsiTerminal(STDIN_FILENO, STDOUT_FILENO) {}
+    AnsiTerminal(const int input, const int output) : input(input), output(output) {}
+    ~AnsiTerminal() { close(); }
+
+    AnsiTerminal(const AnsiTerminal &)            = delete;
+    AnsiTerminal &operator=(const AnsiTerminal &) = delete;
+
+    void open();  // Enter raw mode and the alternate screen, and watch for resizes and exit signals
+    void close(); // Restore the terminal as it was before open
+
+    [[nodiscard]] Vec2             get_size() const { return size; }                                                  // Get the size of the terminal (in cells)
+    [[nodiscard]] int              get_input() const { return input; }                                                // Get the file descriptor keys are read from
+    [[nodiscard]] unsigned long    get_writes() const { return writes; }                                              // Get the number of write calls made so far
+    [[nodiscard]] std::string_view get_frame() const { return encoder.get_frame(); }                                  // Get the bytes of the frame being assembled
+    [[nodiscard]] bool             has_pending_input() const { return input_start < input_end || is_resize_pending(); } // Check if a key can be read without waiting
+
+    void set_synchronized(const bool enabled) { encoder.set_synchronized(enabled); } // Wrap frames in synchronized updates
+    void resize(const Vec2 &new_size);                                              // Set the size and preallocate the frame buffer for it
+    bool update_size();                                                             // Query the size after a resize signal, returns true if it changed
+
+    void begin_frame() { encoder.begin_frame(); }                                                                       // Start assembling a frame
+    void write_span(const int x, const int y, const Cell *cells, const int n) { encoder.write_span(x, y, cells, n); } // Append a run of cells to the frame
+    bool end_frame();                                                                                                   // Push the frame with one write, returns false on failure
+
+    int read_key(); // Read one pending key, KEY_CODE_NONE when nothing is pending
+
+private:
+    int     input;                     // File descriptor keys are read from
+    int     output;                    // File descriptor frames are written to
+    bool    opened     = false;        // Flag set between open and close
+    bool    raw        = false;        // Flag set when the input was switched to raw mode
+    Vec2    size       = Vec2(80, 24); // Size of the terminal (in cells), kept when the output is not a terminal
+    termios saved_mode = {};           // Mode of the input before open
+
+    AnsiEncoder   encoder = {}; // Frame bytes, preallocated for a full redraw of the terminal
+    unsigned long writes  = 0;  // Number of write calls made so far
+
+    char input_buffer[ANSI_INPUT_BYTES] = {}; // Bytes read from the input
+    int  input_start                    = 0;  // Offset of the first byte not decoded yet
+    int  input_end                      = 0;  // Offset after the last byte read
+
+    int resizes_applied  = resize_signals; // Resize signals applied to the size
+    int resizes_reported = resize_signals; // Resize signals reported as a key
+
+    inline static volatile std::sig_atomic_t resize_signals = 0; // Number of resize signals received
+
+    // Copy of what an exit signal restores, as its handler cannot reach the terminal object
+    inline static int              exit_input  = -1; // Input switched to raw mode, -1 if none
+    inline static int              exit_output = -1; // Output showing the alternate screen, -1 if none
+    inline static termios          exit_mode   = {}; // Mode to restore on the input
+    inline static struct sigaction exit_actions[std::size(ANSI_EXIT_SIGNALS)] = {}; // Handlers of the exit signals before open
+
+    [[nodiscard]] bool is_resize_pending() const { return resizes_reported != resize_signals; }
+
+    bool query_size();                                    // Read the size of the terminal, returns true if it changed
+    bool write_all(const char *bytes, std::size_t count); // Write bytes to the output, returns false on failure
+
+    static void on_resize(int);             // Resize signal handler
+    static void on_exit_signal(int signal); // Exit signal handler, restores the terminal and ends the program
+};
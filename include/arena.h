@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+constexpr std::size_t ARENA_BLOCK_SIZE = 64 * 1024; // Default size of an arena block (in bytes)
+
+// Monotonic bump allocator usable by any std::pmr container. Allocation moves a pointer, deallocation does nothing,
+// and the whole arena (or everything allocated after a mark) is released in O(1) by moving the pointer back. Blocks
+// are kept when released, so a search reusing the arena every turn stops touching the heap after its first turn.
+// An arena is not thread-safe: every thread gets its own with Arena::local(), so parallel searches never share a lock.
+class Arena final : public std::pmr::memory_resource {
+public:
+    // Position in the arena, everything allocated after it can be released at once
+    struct Mark {
+        void       *block  = nullptr; // Block of the position
+        std::size_t offset = 0;       // Offset of the position in its block
+    };
+
+    explicit Arena(const std::size_t block_size = ARENA_BLOCK_SIZE, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+        : block_size(block_size), upstream(upstream) {}
+    ~Arena() override { release_blocks(); }
+
+    Arena(const Arena &)            = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    [[nodiscard]] Mark        mark() const { return Mark{current, offset}; }                            // Get the current position
+    [[nodiscard]] std::size_t get_used() const { return current == nullptr ? 0 : current->start + offset; } // Get the number of bytes in use
+    [[nodiscard]] std::size_t get_capacity() const { return capacity; }                                 // Get the number of bytes owned by the arena
+    [[nodiscard]] std::size_t get_blocks() const { return blocks; }                                     // Get the number of blocks owned by the arena
+
+    // Release everything allocated after a mark, keeping the blocks
+    void rewind(const Mark &mark) {
+        current = static_cast<Block *>(mark.block);
+        offset  = mark.offset;
+    }
+    void reset() { rewind(Mark{first, 0}); } // Release everything, keeping the blocks
+
+    // Return every block to the upstream resource
+    void release_blocks() {
+        while (first != nullptr) {
+            const auto next = first->next;
+            upstream->deallocate(first, sizeof(Block) + first->size, alignof(Block));
+            first = next;
+        }
+        current  = nullptr;
+        offset   = 0;
+        capacity = 0;
+        blocks   = 0;
+    }
+
+    // Get the arena of the calling thread
+    static Arena &local() {
+        thread_local Arena arena;
+        return arena;
+    }
+
+private:
+    // Header of a block, its memory follows
+    struct alignas(std::max_align_t) Block {
+        Block      *next;  // Next block of the chain
+        std::size_t size;  // Size of the memory of the block (in bytes)
+        std::size_t start; // Bytes of the blocks before this one
+
+        [[nodiscard]] std::byte *data() { return reinterpret_cast<std::byte *>(this + 1); }
+    };
+
+    std::size_t                block_size;         // Size of a new block (in bytes)
+    std::pmr::memory_resource *upstream;           // Resource of the blocks
+    Block                     *first    = nullptr; // First block of the chain
+    Block                     *current  = nullptr; // Block being allocated from
+    std::size_t                offset   = 0;       // Offset of the next allocation in the current block
+    std::size_t                capacity = 0;       // Bytes of all blocks
+    std::size_t                blocks   = 0;       // Number of blocks
+
+    void *do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        while (true) {
+            if (current != nullptr) {
+                const auto address = reinterpret_cast<std::uintptr_t>(current->data()) + offset;
+                const auto aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+                const auto end     = aligned - reinterpret_cast<std::uintptr_t>(current->data()) + bytes;
+                if (end <= current->size) {
+                    offset = end;
+                    return reinterpret_cast<void *>(aligned);
+                }
+            }
+
+            // Move on to the next block, reusing the blocks kept by a reset before growing the chain
+            auto next = current == nullptr ? first : current->next;
+            if (next == nullptr || next->size < bytes + alignment) { next = grow(bytes + alignment, next); }
+            current = next;
+            offset  = 0;
+        }
+    }
+    void do_deallocate(void *, std::size_t, std::size_t) override {} // Memory is only released by rewind or reset
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+    // Insert a new block of at least the given size after the current one
+    Block *grow(const std::size_t minimum, Block *next) {
+        const auto size  = std::max(block_size, minimum);
+        const auto block = static_cast<Block *>(upstream->allocate(sizeof(Block) + size, alignof(Block)));
+        block->next      = next;
+        block->size      = size;
+        block->start     = current == nullptr ? 0 : current->start + current->size;
+
+        if (current == nullptr) { first = block; }
+        else { current->next = block; }
+        for (auto after = next; after != nullptr; after = after->next) { after->start += size; }
+
+        capacity += size;
+        ++blocks;
+        return block;
+    }
+};
+
+// Release everything allocated from an arena during a scope
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena &arena) : arena(arena), start(arena.mark()) {}
+    ~ArenaScope() { arena.rewind(start); }
+
+    ArenaScope(const ArenaScope &)            = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+
+    [[nodiscard]] Arena &get_arena() const { return arena; } // Get the arena of the scope
+
+private:
+    Arena       &arena; // Arena released at the end of the scope
+    Arena::Mark  start; // Position of the arena when the scope started
+};
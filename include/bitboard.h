@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include "board-matrix.h"
+#include "configs/constants.h"
+#include "vec2.h"
+
+using BitRow = std::uint32_t; // One row of occupancy bits, bit x is set when column x is filled
+
+constexpr int BITBOARD_SHAPE_ROWS = 4; // Maximum number of rows a shape mask can span
+
+using ShapeMask = std::array<BitRow, BITBOARD_SHAPE_ROWS>; // Occupancy rows of a shape, relative to its top-left corner
+using Skyline   = std::array<int, GAME_GRID_WIDTH>;        // Height of the topmost occupied cell of every column (0 when empty)
+using GameGrid  = BoardMatrix<unsigned char, GAME_GRID_WIDTH, GAME_GRID_HEIGHT>; // Color of every cell of the game grid
+
+static_assert(GAME_GRID_WIDTH <= 32, "BitRow is too narrow for the game grid width");
+static_assert(std::is_trivially_copyable_v<GameGrid>, "The game grid must copy like a plain array");
+
+struct Bitboard {
+    static constexpr int    WIDTH    = GAME_GRID_WIDTH;                // Width of the board (in cells)
+    static constexpr int    HEIGHT   = GAME_GRID_HEIGHT;               // Height of the board (in cells)
+    static constexpr BitRow FULL_ROW = (BitRow{1} << WIDTH) - 1;       // Mask of a completely filled row
+
+    std::array<BitRow, HEIGHT> rows{}; // Occupancy of each row, top to bottom
+
+    [[nodiscard]] bool is_filled(const int x, const int y) const { return (rows[y] >> x) & 1; } // Check if a cell is occupied
+    [[nodiscard]] bool is_row_full(const int y) const { return rows[y] == FULL_ROW; }           // Check if a row is completely filled
+    [[nodiscard]] bool is_row_empty(const int y) const { return rows[y] == 0; }                 // Check if a row is completely empty
+
+    void set(const int x, const int y) { rows[y] |= BitRow{1} << x; }     // Mark a cell as occupied
+    void reset(const int x, const int y) { rows[y] &= ~(BitRow{1} << x); } // Mark a cell as empty
+    void clear() { rows.fill(0); }                                         // Mark every cell as empty
+
+    // Check if a shape mask placed at the given position overlaps occupied cells (the shape must be in bounds)
+    [[nodiscard]] bool intersects(const ShapeMask &mask, const int mask_height, const Vec2 &pos) const {
+        for (int y = 0; y < mask_height; ++y) {
+            if ((mask[y] << pos.x) & rows[pos.y + y]) { return true; }
+        }
+        return false;
+    }
+
+    // Mark every cell of a shape mask placed at the given position as occupied
+    void place(const ShapeMask &mask, const int mask_height, const Vec2 &pos) {
+        for (int y = 0; y < mask_height; ++y) { rows[pos.y + y] |= mask[y] << pos.x; }
+    }
+
+    // Compute the height of every column, scanning rows from the top until all columns are found
+    [[nodiscard]] Skyline column_heights() const {
+        Skyline heights{};
+        BitRow  seen = 0;
+        for (int y = 0; y < HEIGHT && seen != FULL_ROW; ++y) {
+            for (BitRow found = rows[y] & ~seen; found != 0; found &= found - 1) { heights[std::countr_zero(found)] = HEIGHT - y; }
+            seen |= rows[y];
+        }
+        return heights;
+    }
+
+    // Build the occupancy of the game grid (non-zero cells are occupied), only its extent matches the board
+    static Bitboard from_grid(const GameGrid &grid) {
+        Bitboard board;
+        for (int y = 0; y < HEIGHT; ++y) {
+            for (int x = 0; x < WIDTH; ++x) {
+                if (grid(x, y) != 0) { board.set(x, y); }
+            }
+        }
+        return board;
+    }
+
+    // Build the occupancy rows of a shape grid
+    static ShapeMask mask_of(const BoardMatrix<unsigned char> &shape_grid) {
+        ShapeMask mask{};
+        for (int y = 0; y < shape_grid.get_height() && y < BITBOARD_SHAPE_ROWS; ++y) {
+            for (int x = 0; x < shape_grid.get_width(); ++x) {
+                if (shape_grid(x, y) != 0) { mask[y] |= BitRow{1} << x; }
+            }
+        }
+        return mask;
+    }
+};
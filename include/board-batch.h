@@ -0,0 +1,53 @@
+#pragma once
+
+#include "bitboard.h"
+
+// Kernels computing the features of a batch, from the most portable to the fastest
+enum class BatchKernel : unsigned char {
+    Scalar, // One board at a time, any CPU
+    Sse2,   // 4 boards at a time, any x86-64 CPU
+    Avx2    // 8 boards at a time, x86-64 CPUs with AVX2
+};
+
+constexpr int BOARD_BATCH_SIZE = 16; // Number of boards of a batch
+
+// Features of every board of a batch, one array per feature (structure of arrays)
+struct BoardBatchFeatures {
+    alignas(32) int height[BOARD_BATCH_SIZE];      // Sum of the column heights
+    alignas(32) int holes[BOARD_BATCH_SIZE];       // Number of empty cells under the top of their column
+    alignas(32) int bumpiness[BOARD_BATCH_SIZE];   // Sum of the height differences between neighbouring columns
+    alignas(32) int wells[BOARD_BATCH_SIZE];       // Sum of the depths of the columns lower than both of their neighbours (walls are full height)
+    alignas(32) int transitions[BOARD_BATCH_SIZE]; // Number of filled/empty changes along every row (walls are filled)
+    alignas(32) int lines[BOARD_BATCH_SIZE];       // Number of lines cleared by the placement that led to the board
+};
+
+// Candidate boards stored row-major across boards (row y of every board is contiguous), so SIMD
+// kernels load the same row of 4 or 8 boards at once and compute all their features together
+class BoardBatch {
+public:
+    [[nodiscard]] int  size() const { return count; }                        // Get the number of boards in the batch
+    [[nodiscard]] bool is_full() const { return count == BOARD_BATCH_SIZE; } // Check if no more board fits
+    [[nodiscard]] bool is_empty() const { return count == 0; }               // Check if the batch has no board
+
+    // Add a board and the number of lines its placement cleared, returns its index in the batch
+    int add(const Bitboard &board, const int cleared_lines) {
+        for (int y = 0; y < Bitboard::HEIGHT; ++y) { rows[y][count] = board.rows[y]; }
+        lines[count] = cleared_lines;
+        return count++;
+    }
+
+    // Remove every board (the rows of unused boards are still computed, but their features are never read)
+    void clear() { count = 0; }
+
+    void compute(BoardBatchFeatures &features) const { compute(features, get_best_kernel()); } // Compute the features of every board with the fastest kernel
+    void compute(BoardBatchFeatures &features, BatchKernel kernel) const;                   // Compute the features of every board with the given kernel
+
+    [[nodiscard]] static bool        is_supported(BatchKernel kernel); // Check if a kernel is compiled in and runs on this CPU
+    [[nodiscard]] static BatchKernel get_best_kernel();                // Get the fastest supported kernel
+    [[nodiscard]] static const char *get_kernel_name(BatchKernel kernel);
+
+private:
+    alignas(32) BitRow rows[Bitboard::HEIGHT][BOARD_BATCH_SIZE] = {}; // Row y of board i at rows[y][i]
+    int lines[BOARD_BATCH_SIZE] = {};                                  // Lines cleared before every board
+    int count                   = 0;                                   // Number of boards in the batch
+};
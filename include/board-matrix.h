@@ -1,11 +1,60 @@
 #pragma once
 
 #include "vec2.h"
+#include <array>
 #include <vector>
 #include <algorithm>
 
-template<std::default_initializable T>
+constexpr int MATRIX_DYNAMIC = -1; // Extent of a matrix sized at runtime
+
+// Grid of cells stored row by row. BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC> is sized at runtime and keeps its cells on the heap,
+// BoardMatrix<T, W, H> has compile-time dimensions and keeps its cells inline, so it copies like a plain array.
+template<std::default_initializable T, int W = MATRIX_DYNAMIC, int H = MATRIX_DYNAMIC>
 struct BoardMatrix {
+    static_assert(W > 0 && H > 0, "A fixed matrix needs positive dimensions");
+
+    constexpr BoardMatrix() = default;
+    constexpr explicit BoardMatrix(const T default_value) { fill(default_value); }
+
+    [[nodiscard]] static constexpr int  get_width() { return W; }                                                     // Get dimensions of the grid
+    [[nodiscard]] static constexpr int  get_height() { return H; }                                                    // Get dimensions of the grid
+    [[nodiscard]] static constexpr int  get_size() { return W * H; }                                                  // Get total size of the grid (width * height)
+    [[nodiscard]] static constexpr int  get_index(const int x, const int y) { return y * W + x; }                     // Get index from coordinates
+    [[nodiscard]] static constexpr int  get_index(const Vec2 &coords) { return get_index(coords.x, coords.y); }       // Get index from position
+    [[nodiscard]] static constexpr bool is_empty() { return false; }                                                  // Check if the grid is empty
+    [[nodiscard]] constexpr T *         get_raw() { return data.data(); }                                             // Get raw pointer to the data
+    [[nodiscard]] constexpr const T *   get_raw() const { return data.data(); }                                       // Get raw pointer to the data
+    [[nodiscard]] constexpr T *         get_row(const int y) { return data.data() + y * W; }                          // Get raw pointer to the first cell of a row
+    [[nodiscard]] constexpr const T *   get_row(const int y) const { return data.data() + y * W; }                    // Get raw pointer to the first cell of a row
+
+    constexpr void fill(const T &value) noexcept { data.fill(value); } // Fill the grid with a specific value
+
+    // Return a new grid rotated 90 degrees clockwise
+    [[nodiscard]] constexpr BoardMatrix<T, H, W> rotate_clockwise() const {
+        BoardMatrix<T, H, W> rotated;
+        for (int y = 0; y < H; ++y) { for (int x = 0; x < W; ++x) { rotated(H - 1 - y, x) = data[y * W + x]; } }
+        return rotated;
+    }
+    // Return a new grid rotated 90 degrees counter-clockwise
+    [[nodiscard]] constexpr BoardMatrix<T, H, W> rotate_counter_clockwise() const {
+        BoardMatrix<T, H, W> rotated;
+        for (int y = 0; y < H; ++y) { for (int x = 0; x < W; ++x) { rotated(y, W - 1 - x) = data[y * W + x]; } }
+        return rotated;
+    }
+
+    constexpr T &      operator()(const int x, const int y) { return data[y * W + x]; }
+    constexpr T &      operator()(const Vec2 &pos) { return (*this)(pos.x, pos.y); }
+    constexpr const T &operator()(const int x, const int y) const { return data[y * W + x]; }
+    constexpr const T &operator()(const Vec2 &pos) const { return (*this)(pos.x, pos.y); }
+
+    constexpr bool operator==(const BoardMatrix &other) const = default;
+
+private:
+    std::array<T, W * H> data{}; // Data storage for the grid
+};
+
+template<std::default_initializable T>
+struct BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC> {
     BoardMatrix() : data(0), width(0), height(0) {}
     BoardMatrix(const int w, const int h, const T default_value = T{}) : data(w * h), width(w), height(h) { fill(default_value); }
 
@@ -21,7 +70,10 @@ struct BoardMatrix {
     [[nodiscard]] int  get_index(const int x, const int y) const { return y * width + x; }           // Get index from coordinates
     [[nodiscard]] int  get_index(const Vec2 &coords) const { return get_index(coords.x, coords.y); } // Get index from position
     [[nodiscard]] bool is_empty() const { return width == 0 || height == 0; }                        // Check if the grid is empty
-    [[nodiscard]] T *  get_raw() const { return data; }                                              // Get raw pointer to the data
+    [[nodiscard]] T *  get_raw() { return data.data(); }                                             // Get raw pointer to the data
+    [[nodiscard]] const T *get_raw() const { return data.data(); }                                   // Get raw pointer to the data
+    [[nodiscard]] T *  get_row(const int y) { return data.data() + y * width; }                      // Get raw pointer to the first cell of a row
+    [[nodiscard]] const T *get_row(const int y) const { return data.data() + y * width; }            // Get raw pointer to the first cell of a row
 
     void fill(const T &value) noexcept; // Fill the grid with a specific value
 
@@ -33,6 +85,8 @@ struct BoardMatrix {
     const T &operator()(const int x, const int y) const { return data[y * width + x]; }
     const T &operator()(const Vec2 &pos) const { return (*this)(pos.x, pos.y); }
 
+    bool operator==(const BoardMatrix &other) const { return width == other.width && height == other.height && data == other.data; }
+
 private:
     std::vector<T> data;   // Data storage for the grid
     int            width;  // Width of the grid
@@ -42,9 +96,9 @@ private:
 // --- Implementation ---
 
 template<std::default_initializable T>
-BoardMatrix<T>::BoardMatrix(const BoardMatrix &other) : data(other.width * other.height), width(other.width), height(other.height) { std::copy(other.data.begin(), other.data.end(), data.begin()); }
+BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::BoardMatrix(const BoardMatrix &other) : data(other.width * other.height), width(other.width), height(other.height) { std::copy(other.data.begin(), other.data.end(), data.begin()); }
 template<std::default_initializable T>
-BoardMatrix<T> &BoardMatrix<T>::operator=(const BoardMatrix &other) {
+BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC> &BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::operator=(const BoardMatrix &other) {
     if (this == &other) { return *this; }
 
     width  = other.width;
@@ -56,13 +110,13 @@ BoardMatrix<T> &BoardMatrix<T>::operator=(const BoardMatrix &other) {
 }
 
 template<std::default_initializable T>
-BoardMatrix<T>::BoardMatrix(BoardMatrix &&other) noexcept : data(other.data), width(other.width), height(other.height) {
+BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::BoardMatrix(BoardMatrix &&other) noexcept : data(std::move(other.data)), width(other.width), height(other.height) {
     other.data.clear();
     other.width  = 0;
     other.height = 0;
 }
 template<std::default_initializable T>
-BoardMatrix<T> &BoardMatrix<T>::operator=(BoardMatrix &&other) noexcept {
+BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC> &BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::operator=(BoardMatrix &&other) noexcept {
     if (this == &other) { return *this; }
 
     data   = std::move(other.data);
@@ -77,16 +131,16 @@ BoardMatrix<T> &BoardMatrix<T>::operator=(BoardMatrix &&other) noexcept {
 }
 
 template<std::default_initializable T>
-void BoardMatrix<T>::fill(const T &value) noexcept { std::fill(data.begin(), data.end(), value); }
+void BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::fill(const T &value) noexcept { std::fill(data.begin(), data.end(), value); }
 
 template<std::default_initializable T>
-BoardMatrix<T> BoardMatrix<T>::rotate_clockwise() const {
+BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC> BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::rotate_clockwise() const {
     BoardMatrix rotated(height, width);
     for (int y = 0; y < height; ++y) { for (int x = 0; x < width; ++x) { rotated.data[x * height + (height - 1 - y)] = data[y * width + x]; } }
     return rotated;
 }
 template<std::default_initializable T>
-BoardMatrix<T> BoardMatrix<T>::rotate_counter_clockwise() const {
+BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC> BoardMatrix<T, MATRIX_DYNAMIC, MATRIX_DYNAMIC>::rotate_counter_clockwise() const {
     BoardMatrix rotated(height, width);
     for (int y = 0; y < height; ++y) { for (int x = 0; x < width; ++x) { rotated.data[(width - 1 - x) * height + y] = data[y * width + x]; } }
     return rotated;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+#include "arena.h"
+#include "bitboard.h"
+#include "board-batch.h"
+#include "game.h"
+#include "move-generator.h"
+#include "transposition-table.h"
+
+// Weights of the board features, positive features are rewarded and negative ones penalized
+struct BotWeights {
+    double height      = -0.510066; // Sum of the column heights
+    double lines       = 0.760666;  // Number of lines cleared by the placement
+    double holes       = -0.35663;  // Number of empty cells under the top of their column
+    double bumpiness   = -0.184483; // Sum of the height differences between neighbouring columns
+    double wells       = -0.1;      // Sum of the depths of the columns lower than both of their neighbours
+    double transitions = -0.1;      // Number of filled/empty changes along every row
+};
+
+// Final placement of a shape and the actions reaching it from the spawn position
+struct BotMove {
+    bool                hold     = false;                                    // Swap with the held shape first
+    std::vector<Action> path     = {};                                       // Actions from the spawn position, ending with the hard drop
+    Vec2                position = Vec2();                                   // Position where the shape locks
+    double              score    = -std::numeric_limits<double>::infinity(); // Heuristic score of the resulting board
+
+    [[nodiscard]] bool is_valid() const { return score != -std::numeric_limits<double>::infinity(); } // Check if a placement was found
+
+    // Call apply(action) for every action of the move, in order, ending with the hard drop
+    template<typename Apply>
+    void for_each_action(Apply &&apply) const {
+        if (hold) { apply(Action::Hold); }
+        for (const auto action : path) { apply(action); }
+    }
+};
+
+constexpr int    BOT_LOOKAHEAD_WIDTH = 6;     // Number of best placements searched one shape deeper
+constexpr double BOT_LOSS_SCORE      = -1000.0; // Score of a board where the next shape cannot spawn
+
+// Placement search bot: finds every reachable lock position of the current shape (and of the held one) with the
+// move generator, scores the resulting boards in SIMD batches and plays the best placement through Game::apply.
+// With lookahead, the best placements are searched one shape deeper, averaging the best follow-up over the 7 possible
+// next shapes (the game shows no preview). Follow-ups are cached in a transposition table that search threads may share.
+class Bot {
+public:
+    explicit Bot(const BotWeights &weights = BotWeights(), const bool lookahead = false, TranspositionTable *table = nullptr)
+        : weights(weights), lookahead(lookahead), table(table) {}
+
+    [[nodiscard]] BotMove find_move(const Game &game); // Find the best placement of the current shape, invalid if the game is over
+    bool                  play(Game &game);            // Play the best placement, returns false if there was none
+
+    [[nodiscard]] double        evaluate(const Bitboard &board, int lines) const;         // Score a board after a placement that cleared the given lines
+    [[nodiscard]] double        score(const BoardBatchFeatures &features, int index) const; // Score a board of a computed batch
+    [[nodiscard]] unsigned long get_evaluated() const { return evaluated; }               // Get the number of placements scored so far
+
+private:
+    // Placement of the current shape and the board it leaves
+    struct Candidate {
+        bool      hold;      // Placement of the held shape
+        Placement placement; // Lock position and the search state reaching it
+        Bitboard  board;     // Board after the placement, filled lines removed
+        int       lines;     // Number of lines the placement cleared
+        double    score;     // Static score of the board
+    };
+    using Candidates = std::pmr::vector<Candidate>; // Placements of a search, allocated from the arena of the thread
+
+    BotWeights             weights;        // Weights of the board features
+    bool                   lookahead;      // Search the best placements one shape deeper
+    TranspositionTable *   table;          // Cache of the follow-up scores (optional, may be shared)
+    unsigned long          evaluated  = 0; // Number of placements scored so far
+    BoardBatch             batch;          // Boards of the placements waiting to be scored
+    int                    batch_base = 0; // Index of the candidate of the first board of the batch
+    MoveGenerator          generators[2];  // Searches of the current shape and of the held one
+    MoveGenerator          follow_ups;     // Searches of the next shapes, with lookahead
+
+    void    search(const Bitboard &board, const Shape &shape, bool hold, Candidates &candidates); // Queue every placement of a shape as a candidate
+    void    flush(Candidates &candidates);                                                        // Score the queued candidates
+    BotMove make_move(const Candidate &candidate, double score) const;                            // Build the move of a candidate with its path
+    float   follow_up(const Bitboard &board);                                                     // Average best score of the next shape on a board
+    float   best_placement(const Bitboard &board, std::uint64_t hash, unsigned int type);         // Best score of a shape spawned on a board
+
+    // Score the queued boards, calling on_score(index in batch, score)
+    template<typename OnScore>
+    void score_batch(OnScore &&on_score) {
+        if (batch.is_empty()) { return; }
+
+        BoardBatchFeatures features;
+        batch.compute(features);
+        for (int i = 0; i < batch.size(); ++i) { on_score(i, score(features, i)); }
+
+        evaluated += batch.size();
+        batch.clear();
+    }
+};
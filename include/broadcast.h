@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <sys/uio.h>
+
+#include "ansi-renderer.h"
+#include "game.h"
+#include "scene.h"
+#include "telnet.h"
+
+#include "configs/constants.h"
+
+constexpr int SPECTATOR_IOVECS = 64; // Most frames handed to one writev
+
+// Frame of a broadcast encoded as escape sequences, shared read-only by every viewer it is queued for
+struct EncodedFrame {
+    std::string   bytes;    // Escape sequences of the frame
+    std::uint64_t sequence; // Number of the frame in its broadcast, a keyframe has the number of the frame it shows
+    bool          keyframe; // Flag set for a whole screen, which a viewer can start from whatever it shows
+};
+
+using FrameRef = std::shared_ptr<const EncodedFrame>; // Reference counted frame, freed once every viewer sent it
+
+// Frames of one game for its spectators. What changed on the screen is encoded once per frame, whatever the number
+// of viewers, and a keyframe only when a viewer needs to start over, at most once per frame.
+class Broadcast {
+public:
+    explicit Broadcast(const Vec2 &size = Vec2(SERVER_SCREEN_WIDTH, SERVER_SCREEN_HEIGHT));
+
+    FrameRef publish(const Game &game); // Draw the game and encode what changed, null if no cell changed
+    FrameRef get_keyframe();            // Get the whole screen as last published
+
+    [[nodiscard]] std::uint64_t get_sequence() const { return sequence; }   // Get the number of the last published frame
+    [[nodiscard]] unsigned long get_keyframes() const { return keyframes; } // Get the number of keyframes encoded
+
+private:
+    Scene          scene;         // Layout of the screen
+    StreamRenderer renderer;      // Encoder of the frame deltas
+    AnsiEncoder    encoder;       // Encoder of the keyframes
+    FrameRef       keyframe;      // Last keyframe encoded
+    std::uint64_t  sequence  = 0; // Number of the last published frame
+    unsigned long  keyframes = 0; // Number of keyframes encoded
+};
+
+// Frames on their way to one viewer, queued as references to the shared frames and sent without a copy. A viewer
+// that falls behind skips the frames it has not started and resumes from a keyframe, so it never holds the game
+// back. One that falls behind again before that keyframe is out cannot keep up at all, and is to be dropped.
+class Spectator {
+public:
+    explicit Spectator(std::size_t limit = SERVER_VIEWER_LIMIT);
+
+    void watch(Broadcast &broadcast);     // Start watching a broadcast, from its keyframe, unless the viewer quit
+    void leave() { broadcast = nullptr; } // Stop watching, the screen stays as it is until the next watch
+    bool offer(const FrameRef &frame);    // Queue a frame of the watched broadcast, returns false if the viewer cannot keep up
+    void receive(std::string_view bytes); // Handle bytes from the viewer: telnet commands, and q to quit
+
+    int  gather(iovec *vectors, int count) const; // Point vectors at the bytes waiting to be sent, returns how many were filled
+    void consume(std::size_t count);              // Drop bytes that were sent
+
+    [[nodiscard]] bool          is_watching() const { return broadcast != nullptr; } // Check if the viewer watches a broadcast
+    [[nodiscard]] bool          has_output() const { return !queue.empty(); }        // Check if bytes are waiting to be sent
+    [[nodiscard]] std::size_t   get_queued_bytes() const { return queued; }          // Get the number of bytes waiting to be sent
+    [[nodiscard]] bool          is_closed() const { return closed; }                 // Check if the viewer quit, the output is its last
+    [[nodiscard]] unsigned long get_keyframes() const { return keyframes; }          // Get the number of keyframes queued
+    [[nodiscard]] unsigned long get_skipped_frames() const { return skipped; }       // Get the number of frames skipped to catch up
+
+private:
+    std::size_t          limit;               // Most bytes queued before skipping to a keyframe
+    Broadcast           *broadcast = nullptr; // Broadcast watched, null if none
+    std::deque<FrameRef> queue     = {};      // Frames waiting to be sent, the first one maybe in part
+    std::size_t          offset    = 0;       // Bytes of the first frame already sent
+    std::size_t          queued    = 0;       // Bytes waiting to be sent
+    std::uint64_t        sequence  = 0;       // Number of the last frame queued
+    int                  pending   = 0;       // Number of keyframes waiting in the queue
+    bool                 closed    = false;   // Flag set when the viewer quit
+    unsigned long        keyframes = 0;       // Number of keyframes queued
+    unsigned long        skipped   = 0;       // Number of frames skipped to catch up
+    TelnetParser         telnet;              // Parser of the received stream
+
+    void push(const FrameRef &frame); // Queue a frame
+    void resume();                    // Skip the frames not started yet and queue a keyframe instead
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bot.h"
+#include "game.h"
+#include "histogram.h"
+#include "key-repeat.h"
+#include "renderer.h"
+#include "replay.h"
+#include "scene.h"
+#include "undo-ring.h"
+
+// Terminal frontend: reads keyboard input, drives the game rules and draws them through a Renderer
+class Client {
+public:
+    bool                      running    = true;    // Flag to control the game loop
+    bool                      autoplay   = false;   // Let the bot play instead of the keyboard
+    unsigned int              max_pieces = 0;       // Stop the game after this many placed shapes, no limit if 0
+    std::unique_ptr<Renderer> renderer   = nullptr; // Backend to draw with, ncurses if still empty at init
+
+    void init();
+    void init(std::uint64_t seed);        // Start with a fixed seed, so a recorded game can be reproduced
+    void record(const std::string &path); // Record the actions of the game to a replay file
+    void loop();
+    bool terminate(); // Restore the terminal and close the replay, returns false if the replay was not fully written
+
+    [[nodiscard]] unsigned long    get_wakeups() const { return wakeups; }             // Get the number of times the loop woke up
+    [[nodiscard]] double           get_wakeups_per_second() const;                     // Get the average loop wakeups per second
+    [[nodiscard]] const Histogram &get_input_latency() const { return input_latency; } // Get the key-to-refresh latencies (in microseconds)
+
+private:
+    Game  game         = Game();  // Game rules and state
+    Scene scene        = Scene(); // Layout of the screen
+    bool  force_redraw = false;   // Flag to force redraw of the game state
+
+    KeyRepeat repeat_left  = KeyRepeat(); // Auto-repeat of the move left key
+    KeyRepeat repeat_right = KeyRepeat(); // Auto-repeat of the move right key
+    KeyRepeat repeat_down  = KeyRepeat(); // Auto-repeat of the move down key
+
+    std::vector<KeyRepeat::time_point> pending_keys  = {};          // Read times of the keys not displayed yet
+    Histogram                          input_latency = Histogram(); // Time from reading a key to the refresh showing it (in microseconds)
+
+    ReplayWriter replay = ReplayWriter(); // Recorder of the actions that changed the game
+    Bot          bot    = Bot();          // Player of the autoplay mode
+
+    UndoRing<GameState, GAME_UNDO_DEPTH> undo_ring = {}; // States before the last placements, disabled while recording
+
+    unsigned long                         wakeups = 0;  // Number of times the loop woke up
+    std::chrono::steady_clock::time_point started = {}; // Time the loop started
+    std::chrono::steady_clock::time_point stopped = {}; // Time the loop stopped
+
+    bool handle_input(KeyRepeat::time_point now);   // Handle one pending key, returns false when no key is pending
+    void handle_repeats(KeyRepeat::time_point now); // Apply the auto-repeats that are due
+    void apply(Action action, int times);           // Apply an action to the game, redrawing if the state changed
+    void remember(const GameState &before);         // Save the state before a step if the step placed a shape
+    void undo();                                    // Go back to the state before the last placement
+    void redraw();                                  // Draw the game state and push it to the terminal
+};
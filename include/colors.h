@@ -0,0 +1,47 @@
+#pragma once
+
+enum class Colors : short {
+    Default = 1,
+    Black,
+    Red,
+    Green,
+    Blue,
+    Yellow,
+    Cyan,
+    Magenta,
+    White
+};
+
+constexpr short COLOR_INVERTED_OFFSET = static_cast<short>(Colors::White);     // Offset of the inverted pair of a color
+constexpr int   COLOR_PAIR_COUNT      = 2 * static_cast<int>(Colors::White) + 1; // Number of color pairs (including the inverted ones)
+
+// Foreground and background of a color pair, as ANSI color numbers (the numbering of ncurses COLOR_* too)
+struct ColorPair {
+    short foreground = -1; // -1 for the terminal default
+    short background = -1; // -1 for the terminal default
+};
+
+// Every color pair a cell can use, pair 0 is the terminal default
+constexpr ColorPair COLOR_PALETTE[COLOR_PAIR_COUNT] = {
+    {-1, -1},
+    // Normal colors
+    {7, 0}, // Default
+    {0, 0}, // Black
+    {1, 0}, // Red
+    {2, 0}, // Green
+    {4, 0}, // Blue
+    {3, 0}, // Yellow
+    {6, 0}, // Cyan
+    {5, 0}, // Magenta
+    {7, 0}, // White
+    // Inverted colors
+    {0, 7}, // Default
+    {7, 7}, // Black
+    {0, 1}, // Red
+    {0, 2}, // Green
+    {0, 4}, // Blue
+    {0, 3}, // Yellow
+    {0, 6}, // Cyan
+    {0, 5}, // Magenta
+    {0, 7}, // White
+};
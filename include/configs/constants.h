@@ -1,10 +1,26 @@
 #pragma once
 
+#include <cstddef>
+
 constexpr int          GAME_GRID_WIDTH  = 10;                                 // Width of the terminal screen (in cells)
 constexpr int          GAME_GRID_HEIGHT = 20;                                 // Height of the terminal screen (in cells)
 constexpr int          GAME_GRID_SIZE   = GAME_GRID_WIDTH * GAME_GRID_HEIGHT; // Total number of cells in the game grid (in cells)
 constexpr unsigned int GAME_TICK_RATE   = 1;                                  // Number of ticks per second
 constexpr int          GAME_HELD_WIDTH  = 4;                                  // Width of the held shape display (in cells)
 constexpr int          GAME_HELD_HEIGHT = 4;                                  // Height of the held shape display (in cells)
+constexpr unsigned int GAME_UNDO_DEPTH  = 32;                                 // Number of placements that can be undone
+constexpr int          GAME_HUD_WIDTH   = 24;                                 // Width of the metrics overlay (in cells)
+
+constexpr unsigned int INPUT_DAS_MS          = 170; // Delay before a held key starts auto-repeating (delayed auto shift)
+constexpr unsigned int INPUT_ARR_MS          = 50;  // Interval between auto-repeats of a held key (auto repeat rate)
+constexpr unsigned int INPUT_REPEAT_DELAY_MS = 700; // Longest wait for the first terminal repeat of a held key
+constexpr unsigned int INPUT_RELEASE_MS      = 100; // Longest gap between terminal repeats of a held key
+
+constexpr unsigned int BOT_MOVE_MS = 250; // Interval between the placements of the bot playing in the terminal
 
-constexpr unsigned int RENDERING_FRAME_RATE = 24; // Target frame rate for the game loop
+constexpr int         SERVER_SCREEN_WIDTH      = 80;         // Screen width of a client until it sends its window size (in cells)
+constexpr int         SERVER_SCREEN_HEIGHT     = 24;         // Screen height of a client until it sends its window size (in cells)
+constexpr int         SERVER_SCREEN_MAX_WIDTH  = 160;        // Widest client screen, bounds the frame buffers of a session (in cells)
+constexpr int         SERVER_SCREEN_MAX_HEIGHT = 60;         // Tallest client screen, bounds the frame buffers of a session (in cells)
+constexpr std::size_t SERVER_OUTPUT_LIMIT      = 512 * 1024; // Most bytes queued for a client before it is dropped
+constexpr std::size_t SERVER_VIEWER_LIMIT      = 64 * 1024;  // Most bytes queued for a spectator before it skips to a keyframe
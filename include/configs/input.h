@@ -1,10 +1,13 @@
 #pragma once
 
-#include <ncursesw/cursesw.h>
+#include "keys.h"
 
-constexpr int INPUT_KEY_UP    = KEY_UP;    // Rotate shape clockwise
-constexpr int INPUT_KEY_DOWN  = KEY_DOWN;  // Move shape down
-constexpr int INPUT_KEY_LEFT  = KEY_LEFT;  // Move shape left
-constexpr int INPUT_KEY_RIGHT = KEY_RIGHT; // Move shape right
-constexpr int INPUT_KEY_SWAP  = 'w';       // Swap shapes
-constexpr int INPUT_KEY_PLACE = ' ';       // Place shape immediately
+constexpr int INPUT_KEY_UP      = KEY_CODE_UP;    // Rotate shape clockwise
+constexpr int INPUT_KEY_DOWN    = KEY_CODE_DOWN;  // Move shape down
+constexpr int INPUT_KEY_LEFT    = KEY_CODE_LEFT;  // Move shape left
+constexpr int INPUT_KEY_RIGHT   = KEY_CODE_RIGHT; // Move shape right
+constexpr int INPUT_KEY_SWAP    = 'w';            // Swap shapes
+constexpr int INPUT_KEY_PLACE   = ' ';            // Place shape immediately
+constexpr int INPUT_KEY_UNDO    = 'z';            // Undo the last placement
+constexpr int INPUT_KEY_METRICS = 'm';            // Show or hide the metrics overlay
+constexpr int INPUT_KEY_QUIT    = 'q';            // Quit the game
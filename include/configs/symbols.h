@@ -10,3 +10,11 @@ constexpr wchar_t SYMBOL_BORDER_TOP_LEFT     = L'┌'; // Symbol for top left co
 constexpr wchar_t SYMBOL_BORDER_TOP_RIGHT    = L'┐'; // Symbol for top right corner
 constexpr wchar_t SYMBOL_BORDER_BOTTOM_LEFT  = L'└'; // Symbol for bottom left corner
 constexpr wchar_t SYMBOL_BORDER_BOTTOM_RIGHT = L'┘'; // Symbol for bottom right corner
+
+// Every symbol with a pre-built glyph in the rendering glyph cache
+constexpr wchar_t SYMBOLS[] = {
+    SYMBOL_EMPTY, SYMBOL_BLOCK, SYMBOL_SHADOW,
+    SYMBOL_BORDER_HORIZONTAL, SYMBOL_BORDER_VERTICAL,
+    SYMBOL_BORDER_TOP_LEFT, SYMBOL_BORDER_TOP_RIGHT, SYMBOL_BORDER_BOTTOM_LEFT, SYMBOL_BORDER_BOTTOM_RIGHT
+};
+constexpr int SYMBOL_COUNT = sizeof(SYMBOLS) / sizeof(SYMBOLS[0]); // Number of symbols with a pre-built glyph
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <ncursesw/cursesw.h>
+#include <vector>
+
+#include "configs/symbols.h"
+#include "renderer.h"
+
+// Renderer drawing through ncurses, one call per run of changed cells
+class CursesRenderer final : public Renderer {
+public:
+    void init() override;
+    void terminate() override;
+
+    bool wait_input(std::chrono::milliseconds timeout) override;
+    int  read_key() override;
+
+protected:
+    [[nodiscard]] Vec2 query_size() override { return Vec2(COLS, LINES); }
+    int                present() override;
+    void               on_resize() override { ::clear(); } // Clear the screen if the size has changed
+
+private:
+    cchar_t              glyphs[SYMBOL_COUNT][COLOR_PAIR_COUNT] = {}; // Pre-built glyph of every symbol in every color pair
+    std::vector<cchar_t> span_buffer                            = {}; // Glyphs of the run being written to the terminal
+
+    void init_palette();                                     // Initialize the color palette and the glyph cache
+    void set_glyph(cchar_t &glyph, const Cell &cell);        // Get the terminal glyph of a cell
+    void write_span(int x, int y, const Cell *cells, int n); // Write a run of cells to the terminal
+};
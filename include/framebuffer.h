@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "vec2.h"
+
+// A single character cell of the terminal
+struct Cell {
+    wchar_t glyph = L' '; // Character displayed in the cell
+    short   color = 0;    // Color pair of the cell
+
+    bool operator==(const Cell &other) const { return glyph == other.glyph && color == other.color; }
+    bool operator!=(const Cell &other) const { return !(*this == other); }
+};
+
+// Shadow copy of the terminal: the frame being drawn and the frame already displayed
+class FrameBuffer {
+public:
+    FrameBuffer() = default;
+    explicit FrameBuffer(const Vec2 &size) { resize(size); }
+
+    [[nodiscard]] Vec2 get_size() const { return size; }                                                                // Get the size of the frame (in cells)
+    [[nodiscard]] bool contains(const int x, const int y) const { return x >= 0 && y >= 0 && x < size.x && y < size.y; } // Check if a cell is inside the frame
+    [[nodiscard]] int  get_changed_cells() const { return changed_cells; }                                                // Get the number of cells changed by the last flush
+
+    Cell &      operator()(const int x, const int y) { return current[y * size.x + x]; } // Access a cell of the frame being drawn
+    const Cell &operator()(const int x, const int y) const { return current[y * size.x + x]; }
+
+    // Resize both frames, the next flush redraws every cell
+    void resize(const Vec2 &new_size) {
+        size = new_size;
+        current.assign(size.x * size.y, Cell());
+        previous.assign(size.x * size.y, Cell());
+        invalidate();
+    }
+
+    // Clear the frame being drawn
+    void clear(const Cell &cell = Cell()) { std::fill(current.begin(), current.end(), cell); }
+
+    // Forget what is displayed, the next flush redraws every cell
+    void invalidate() { std::fill(previous.begin(), previous.end(), Cell{L'\0', -1}); }
+
+    // Emit every run of changed cells as emit(x, y, cells, count), then mark the frame as displayed
+    template<typename Emit>
+    int flush(Emit &&emit) {
+        changed_cells = 0;
+
+        for (int y = 0; y < size.y; ++y) {
+            const auto row = y * size.x;
+            int        x   = 0;
+            while (x < size.x) {
+                if (current[row + x] == previous[row + x]) {
+                    ++x;
+                    continue;
+                }
+
+                // Extend the run over every following changed cell
+                int end = x + 1;
+                while (end < size.x && current[row + end] != previous[row + end]) { ++end; }
+
+                emit(x, y, &current[row + x], end - x);
+                std::copy(current.begin() + row + x, current.begin() + row + end, previous.begin() + row + x);
+
+                changed_cells += end - x;
+                x = end;
+            }
+        }
+
+        return changed_cells;
+    }
+
+private:
+    Vec2              size;              // Size of the frame (in cells)
+    std::vector<Cell> current;           // Frame being drawn
+    std::vector<Cell> previous;          // Frame currently displayed
+    int               changed_cells = 0; // Number of cells changed by the last flush
+};
@@ -1,42 +1,128 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
 #include "configs/constants.h"
+#include "bitboard.h"
 #include "board-matrix.h"
+#include "random.h"
 #include "shape.h"
 
-class Game {
+// Player actions understood by the game rules
+enum class Action : unsigned char {
+    Left,     // Move shape left
+    Right,    // Move shape right
+    SoftDrop, // Move shape down by one row
+    HardDrop, // Place shape at its landing position
+    Rotate,   // Rotate shape clockwise
+    Hold      // Swap the current shape with the held one
+};
+
+// Rows removed by a single placement
+struct LineClear {
+    int                                  count = 0;  // Number of removed rows
+    std::array<int, BITBOARD_SHAPE_ROWS> rows  = {}; // Indices of the removed rows (before removal), top to bottom
+};
+
+// Shapes left in the current bag, drawn from the back
+struct ShapeBag {
+    unsigned char types[SHAPE_COUNT] = {}; // Types of the shapes left
+    int           count              = 0;  // Number of shapes left
+
+    [[nodiscard]] bool                 empty() const { return count == 0; }                     // Check if every shape was drawn
+    [[nodiscard]] std::size_t          size() const { return static_cast<std::size_t>(count); } // Get the number of shapes left
+    [[nodiscard]] unsigned char        back() const { return types[count - 1]; }                // Get the next shape
+    [[nodiscard]] unsigned char        operator[](const std::size_t i) const { return types[i]; } // Get the shape at an index
+    [[nodiscard]] unsigned char *      begin() { return types; }                                // Get the first shape left
+    [[nodiscard]] unsigned char *      end() { return types + count; }                          // Get the end of the shapes left
+    [[nodiscard]] const unsigned char *begin() const { return types; }                          // Get the first shape left
+    [[nodiscard]] const unsigned char *end() const { return types + count; }                    // Get the end of the shapes left
+
+    void pop_back() { --count; } // Draw the next shape
+    void clear() { count = 0; }  // Draw every shape
+
+    // Put every shape back, in type order
+    void refill() {
+        for (int type = 0; type < SHAPE_COUNT; ++type) { types[type] = static_cast<unsigned char>(type); }
+        count = SHAPE_COUNT;
+    }
+};
+
+// Every value that defines a game, with no pointer or heap storage, so a snapshot is a single copy
+struct GameState {
+    GameGrid      grid       = GameGrid(); // Color of each cell of the game grid, stored inline
+    Bitboard      occupancy  = Bitboard(); // One bit per occupied cell of the game grid
+    Skyline       skyline    = {};         // Height of every column of the game grid
+    std::uint64_t board_hash = 0;          // Zobrist hash of the occupied cells
+
+    ShapeBag      shapes_pool      = {};      // Pool of next shapes to be played
+    Shape         current_shape    = Shape(); // Current shape being played
+    Shape         held_shape       = Shape(); // Shape to swap with the current shape
+    Vec2          landing_position = Vec2();  // Position where the current shape will land
+    bool          can_swap         = true;    // Flag to indicate if swapping shapes is allowed
+    bool          over             = false;   // Flag to indicate that a new shape could not be spawned
+    unsigned int  pieces_placed    = 0;       // Number of shapes placed on the grid
+    unsigned int  lines_cleared    = 0;       // Number of lines removed from the grid
+    LineClear     last_clear       = {};      // Rows removed by the last placement
+    unsigned int  ticks            = 0;       // Number of gravity ticks
+    std::uint64_t seed             = 0;       // Seed of the shape generator
+    Xoshiro256    rng              = {};      // Generator of the shape order
+};
+
+static_assert(std::is_trivially_copyable_v<GameState>, "A game state must be restorable with a single copy");
+
+// Game rules and state, independent of any terminal or rendering
+class Game : private GameState {
 public:
-    bool                       running = true;                                                          // Flag to control the game loop
-    BoardMatrix<unsigned char> grid    = BoardMatrix<unsigned char>(GAME_GRID_WIDTH, GAME_GRID_HEIGHT); // Pointer to the game grid
+    void init();                   // Start a new game with a random seed
+    void init(std::uint64_t seed); // Start a new game, the same seed and actions always play the same game
 
-    void init();
-    void loop();
-    void terminate();
+    bool apply(Action action); // Apply a player action, returns true if the game state changed
+    bool tick();               // Advance gravity by one tick, returns true if the game state changed
 
-private:
-    std::vector<unsigned int> shapes_pool        = {};      // Pool of next shapes to be played
-    Shape                     current_shape      = Shape(); // Current shape being played
-    Shape                     held_shape         = Shape(); // Shape to swap with the current shape
-    Vec2                      landing_position   = Vec2();  // Position where the current shape will land
-    bool                      can_swap           = true;    // Flag to indicate if swapping shapes is allowed
-    bool                      held_shape_changed = false;   // Flag to indicate if the held shape has changed
-    bool                      force_redraw       = false;   // Flag to force redraw of the game state
+    [[nodiscard]] bool                              is_over() const { return over; }                          // Check if the game has ended
+    [[nodiscard]] const GameGrid &                  get_grid() const { return grid; }                         // Get the color plane of the game grid
+    [[nodiscard]] const Bitboard &                  get_occupancy() const { return occupancy; }               // Get the occupancy plane of the game grid
+    [[nodiscard]] const Skyline &                   get_skyline() const { return skyline; }                   // Get the height of every column of the game grid
+    [[nodiscard]] const Shape &                     get_current_shape() const { return current_shape; }       // Get the shape being played
+    [[nodiscard]] const Shape &                     get_held_shape() const { return held_shape; }             // Get the held shape
+    [[nodiscard]] const Vec2 &                      get_landing_position() const { return landing_position; } // Get the landing position of the current shape
+    [[nodiscard]] bool                              is_swap_allowed() const { return can_swap; }              // Check if the current shape can be swapped
+    [[nodiscard]] unsigned int                      get_pieces_placed() const { return pieces_placed; }       // Get the number of placed shapes
+    [[nodiscard]] unsigned int                      get_lines_cleared() const { return lines_cleared; }       // Get the number of cleared lines
+    [[nodiscard]] const LineClear &                 get_last_clear() const { return last_clear; }             // Get the rows removed by the last placement
+    [[nodiscard]] unsigned int                      get_ticks() const { return ticks; }                       // Get the number of gravity ticks
+    [[nodiscard]] std::uint64_t                     get_seed() const { return seed; }                         // Get the seed of the shape generator
+    [[nodiscard]] std::uint64_t                     get_checksum() const;                                     // Get a checksum of the whole game state
+    [[nodiscard]] std::uint64_t                     get_board_hash() const { return board_hash; }             // Get the Zobrist hash of the occupied cells
+    [[nodiscard]] std::uint64_t                     get_hash() const;                                         // Get the Zobrist hash of the occupied cells, the shapes and the bag
 
+    void set_grid(const GameGrid &new_grid); // Replace the game grid, keeping the occupancy plane in sync
 
-    void handle_input();
-    void draw();
-    void tick();
+    [[nodiscard]] GameState snapshot() const { return *this; }                               // Capture the whole game state, shape generator included
+    void                    restore(const GameState &state) { GameState::operator=(state); } // Go back to a captured state
 
-    bool next_shape();
-    bool move_shape(const Vec2 &position);
-    bool translate_shape(const Vec2 &position) { return move_shape(current_shape.position + position); }
-    void update_landing_position();
+    [[nodiscard]] bool is_shape_inbounds(const Shape &shape, const Vec2 &pos) const;
+    [[nodiscard]] bool is_shape_intersecting(const Shape &shape, const Vec2 &pos) const;
+    [[nodiscard]] bool is_shape_placeable(const Shape &shape, const Vec2 &pos) const { return is_shape_placeable(occupancy, shape, pos); }
+
+    // Check if a shape fits at a position of any board, the collision rule of every move
+    [[nodiscard]] static bool is_shape_placeable(const Bitboard &board, const Shape &shape, const Vec2 &pos);
 
-    void place_shape();
-    void swap_shapes();
+    // --- Rule primitives (used by apply/tick, exposed for tools and benchmarks) ---
 
-    void remove_filled_lines();
+    bool      next_shape();              // Spawn the next shape from the pool, returns false if it does not fit
+    void      update_landing_position(); // Recompute where the current shape will land
+    void      land_shape();              // Move the current shape to its landing position
+    void      place_shape();             // Lock the current shape into the grid at its position
+    LineClear remove_filled_lines(int top, int height); // Remove the filled lines among at most 4 rows of the grid in a single pass
 
-    [[nodiscard]] bool is_shape_inbounds(const BoardMatrix<unsigned char> &shape_grid, const Vec2 &pos) const;
-    [[nodiscard]] bool is_shape_intersecting(const BoardMatrix<unsigned char> &shape_grid, const Vec2 &pos) const;
+private:
+    bool spawn_shape();
+    bool move_shape(const Vec2 &position);
+    bool translate_shape(const Vec2 &position) { return move_shape(current_shape.position + position); }
+    bool rotate_shape();
+    bool swap_shapes();
 };
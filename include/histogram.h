@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+// Log-linear histogram (HDR style): values are bucketed with 16 linear sub-buckets per power of two,
+// so every recorded value is kept within ~6% of its true value at a fixed memory cost
+class Histogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;                      // Precision of every power of two (in bits)
+    static constexpr int SUB_BUCKETS     = 1 << SUB_BUCKET_BITS;   // Number of linear sub-buckets per power of two
+    static constexpr int BUCKETS         = 64 * SUB_BUCKETS;       // Enough buckets for any 64-bit value
+
+    void record(const std::uint64_t value, const std::uint64_t times = 1) {
+        counts[bucket_of(value)] += times;
+        count += times;
+        sum += value * times;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    void merge(const Histogram &other) {
+        for (int i = 0; i < BUCKETS; ++i) { counts[i] += other.counts[i]; }
+        count += other.count;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+
+    void reset() { *this = Histogram(); }
+
+    [[nodiscard]] std::uint64_t get_count() const { return count; }                                                   // Get the number of recorded values
+    [[nodiscard]] std::uint64_t get_min() const { return count == 0 ? 0 : min; }                                      // Get the smallest recorded value
+    [[nodiscard]] std::uint64_t get_max() const { return max; }                                                       // Get the largest recorded value
+    [[nodiscard]] double        get_mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / count; }    // Get the average recorded value
+    [[nodiscard]] std::uint64_t get_bucket_count(const int bucket) const { return counts[bucket]; }                   // Get the number of values in a bucket
+
+    // Get the value below which the given percentage (0 to 100) of the recorded values fall
+    [[nodiscard]] std::uint64_t percentile(const double percent) const {
+        if (count == 0) { return 0; }
+
+        const auto target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(percent / 100.0 * static_cast<double>(count) + 0.5));
+        std::uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            seen += counts[i];
+            if (seen >= target) { return std::clamp(bucket_upper(i), get_min(), max); }
+        }
+        return max;
+    }
+
+    // Get the bucket of a value
+    static int bucket_of(const std::uint64_t value) {
+        if (value < 2 * SUB_BUCKETS) { return static_cast<int>(value); }
+        const int shift = std::bit_width(value) - 1 - SUB_BUCKET_BITS;
+        return shift * SUB_BUCKETS + static_cast<int>(value >> shift);
+    }
+
+    // Get the smallest value of a bucket
+    static std::uint64_t bucket_lower(const int bucket) {
+        if (bucket < 2 * SUB_BUCKETS) { return bucket; }
+        const int shift = bucket / SUB_BUCKETS - 1;
+        return static_cast<std::uint64_t>(bucket - shift * SUB_BUCKETS) << shift;
+    }
+
+    // Get the largest value of a bucket
+    static std::uint64_t bucket_upper(const int bucket) {
+        if (bucket < 2 * SUB_BUCKETS) { return bucket; }
+        const int shift = bucket / SUB_BUCKETS - 1;
+        return bucket_lower(bucket) + (std::uint64_t{1} << shift) - 1;
+    }
+
+private:
+    std::array<std::uint64_t, BUCKETS> counts = {};         // Number of values in every bucket
+    std::uint64_t                      count  = 0;          // Number of recorded values
+    std::uint64_t                      sum    = 0;          // Sum of the recorded values
+    std::uint64_t                      min    = UINT64_MAX; // Smallest recorded value
+    std::uint64_t                      max    = 0;          // Largest recorded value
+};
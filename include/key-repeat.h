@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include "configs/constants.h"
+
+// Delayed auto shift / auto repeat rate for one key, driven by our own timers.
+// Terminals only report key presses (and their own auto-repeat), never releases, so a key
+// counts as held while presses keep arriving within the repeat windows below.
+class KeyRepeat {
+public:
+    using clock      = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    // Register a press (or a terminal repeat) of the key, returns how many times its action applies now
+    int press(const time_point now) {
+        if (!is_held(now)) {
+            // New press
+            held       = true;
+            repeating  = false;
+            first_time = now;
+            last_time  = now;
+            return 1;
+        }
+
+        const auto gap = now - last_time;
+        last_time      = now;
+        if (repeating) { return 0; } // Our own timer drives the key now
+
+        // Separate taps still move once each, only terminal repeat cadence past the shift delay means held
+        if (gap > release_window || now - first_time < das) { return 1; }
+
+        // Held past the shift delay, switch to our own repeat rate
+        repeating   = true;
+        repeat_time = now;
+        return 1;
+    }
+
+    // Advance the timers, returns how many auto-repeats are due
+    int update(const time_point now) {
+        if (!is_held(now)) {
+            held      = false;
+            repeating = false;
+            return 0;
+        }
+        if (!repeating) { return 0; }
+
+        int repeats = 0;
+        while (now - repeat_time >= arr) {
+            repeat_time += arr;
+            ++repeats;
+        }
+        return repeats;
+    }
+
+    // Get the next time update() has something to do
+    [[nodiscard]] std::optional<time_point> next_deadline() const {
+        if (!held) { return std::nullopt; }
+        const auto release = last_time + (repeating ? release_window : repeat_window);
+        return repeating ? std::min(release, repeat_time + arr) : release;
+    }
+
+    // Check if the key is still considered held
+    [[nodiscard]] bool is_held(const time_point now) const { return held && now - last_time <= (repeating ? release_window : repeat_window); }
+
+    [[nodiscard]] bool is_repeating() const { return repeating; } // Check if the key is auto-repeating
+
+private:
+    std::chrono::milliseconds das            = std::chrono::milliseconds(INPUT_DAS_MS);            // Delay before auto-repeat starts
+    std::chrono::milliseconds arr            = std::chrono::milliseconds(INPUT_ARR_MS);            // Interval between auto-repeats
+    std::chrono::milliseconds repeat_window  = std::chrono::milliseconds(INPUT_REPEAT_DELAY_MS);   // Wait for the first terminal repeat
+    std::chrono::milliseconds release_window = std::chrono::milliseconds(INPUT_RELEASE_MS);        // Gap between terminal repeats that means released
+
+    bool       held        = false; // Flag to indicate the key is considered held
+    bool       repeating   = false; // Flag to indicate the key is auto-repeating
+    time_point first_time  = {};    // Time of the press that started the hold
+    time_point last_time   = {};    // Time of the last press or terminal repeat
+    time_point repeat_time = {};    // Time of the last auto-repeat
+};
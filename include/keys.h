@@ -0,0 +1,11 @@
+#pragma once
+
+// Key codes read from the terminal, independent from the rendering backend. Printable keys are their character,
+// special keys are above the byte range.
+constexpr int KEY_CODE_NONE   = -1;    // No key pending
+constexpr int KEY_CODE_ESCAPE = 27;    // Escape key alone
+constexpr int KEY_CODE_UP     = 0x101; // Up arrow
+constexpr int KEY_CODE_DOWN   = 0x102; // Down arrow
+constexpr int KEY_CODE_LEFT   = 0x103; // Left arrow
+constexpr int KEY_CODE_RIGHT  = 0x104; // Right arrow
+constexpr int KEY_CODE_RESIZE = 0x105; // Terminal resized
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "histogram.h"
+
+#ifndef TETRIS_METRICS
+#define TETRIS_METRICS 1
+#endif
+
+constexpr bool METRICS_ENABLED = TETRIS_METRICS != 0; // Record metrics, off to compile every probe away
+
+// Timed phases of the frame loop
+enum class Phase : int {
+    Input,   // Read the pending keys and apply them
+    Bot,     // Search and play the autoplay move
+    Tick,    // Advance gravity
+    Update,  // Prepare the terminal for a frame
+    Draw,    // Draw the game into the frame
+    Refresh, // Push the changed cells to the terminal
+    Frame,   // Whole redraw: update, draw and refresh
+    Count
+};
+
+// Counted events
+enum class Counter : int {
+    CollisionChecks, // Shape placement checks
+    CellsDrawn,      // Cells written to the frame
+    CellsChanged,    // Cells pushed to the terminal
+    LinesCleared,    // Lines removed from the grid
+    Count
+};
+
+constexpr int PHASE_COUNT   = static_cast<int>(Phase::Count);   // Number of timed phases
+constexpr int COUNTER_COUNT = static_cast<int>(Counter::Count); // Number of counted events
+
+// Registry of the phase durations (in nanoseconds) and event counts of a thread. Recording is a histogram update
+// or an increment on the calling thread's own registry, so probes take no lock and threads never share a cache line.
+class Metrics {
+public:
+    void record(const Phase phase, const std::uint64_t nanoseconds) { phases[static_cast<int>(phase)].record(nanoseconds); }
+    void count(const Counter counter, const std::uint64_t times = 1) { counters[static_cast<int>(counter)] += times; }
+    void reset() { *this = Metrics(); }
+
+    [[nodiscard]] const Histogram &get_phase(const Phase phase) const { return phases[static_cast<int>(phase)]; }       // Get the durations of a phase (in nanoseconds)
+    [[nodiscard]] std::uint64_t    get_counter(const Counter counter) const { return counters[static_cast<int>(counter)]; } // Get the count of an event
+
+    bool dump(const std::string &path) const; // Write every histogram and counter to a text file, returns false on failure
+
+    static const char *get_phase_name(Phase phase);       // Get the display name of a phase
+    static const char *get_counter_name(Counter counter); // Get the display name of a counter
+
+    // Get the registry of the calling thread, constant-initialized so a probe costs no initialization check
+    static Metrics &local() {
+        thread_local constinit Metrics metrics;
+        return metrics;
+    }
+
+private:
+    std::array<Histogram, PHASE_COUNT>       phases   = {}; // Durations of every phase (in nanoseconds)
+    std::array<std::uint64_t, COUNTER_COUNT> counters = {}; // Count of every event
+};
+
+// Count an event on the registry of the calling thread, compiled away without metrics
+inline void count_metric(const Counter counter, const std::uint64_t times = 1) {
+    if constexpr (METRICS_ENABLED) { Metrics::local().count(counter, times); }
+}
+
+// Record the duration of a scope as a phase, compiled away without metrics
+class PhaseTimer {
+public:
+    explicit PhaseTimer(const Phase phase) : phase(phase) {
+        if constexpr (METRICS_ENABLED) { started = std::chrono::steady_clock::now(); }
+    }
+    ~PhaseTimer() {
+        if constexpr (METRICS_ENABLED) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+            Metrics::local().record(phase, static_cast<std::uint64_t>(elapsed));
+        }
+    }
+
+    PhaseTimer(const PhaseTimer &)            = delete;
+    PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+private:
+    Phase                                 phase;   // Phase being timed
+    std::chrono::steady_clock::time_point started; // Start of the scope
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "bitboard.h"
+#include "game.h"
+#include "shape.h"
+
+constexpr int MOVE_GENERATOR_STATES = SHAPE_ROTATIONS * Bitboard::WIDTH * Bitboard::HEIGHT; // Number of (rotation, x, y) states of a shape
+
+static_assert(Bitboard::HEIGHT < 32, "Collision columns must fit one bit per row and a stop bit");
+
+// Lock position of a shape and the search state the hard drop starts from
+struct Placement {
+    Shape         shape = Shape(); // Shape at the position where it locks
+    std::uint16_t state = 0;       // Index of the state the hard drop is played from
+};
+
+// Reachability search of every lock position of a shape, with the moves of Game::apply (left, right, soft drop and
+// rotation with its one-row-up fallback). A breadth-first search over (rotation, x, y) states from the current
+// position finds soft-drop tucks and rotation spins the simple rotate-shift-drop search misses, and keeps the
+// shortest input path to each of them. Collisions are looked up in a column per rotation and x, one bit per row,
+// computed once per board; visited states are kept in the same layout.
+class MoveGenerator {
+public:
+    // Find every distinct lock position of a shape from its position on a board, returns the number of placements
+    int generate(const Bitboard &board, const Shape &shape);
+
+    [[nodiscard]] const Placement *begin() const { return placements; }       // Get the first placement
+    [[nodiscard]] const Placement *end() const { return placements + count; } // Get the end of the placements
+    [[nodiscard]] int              size() const { return count; }             // Get the number of placements
+    [[nodiscard]] int              get_explored() const { return explored; }  // Get the number of states reached by the last search
+
+    // Call apply(action) for every action reaching a placement from the start position, ending with the hard drop
+    template<typename Apply>
+    void for_each_action(const Placement &placement, Apply &&apply) const {
+        Action path[MOVE_GENERATOR_STATES];
+        int    length = 0;
+        for (auto state = placement.state; state != start; state = parents[state]) { path[length++] = moves[state]; }
+
+        while (length > 0) { apply(path[--length]); }
+        apply(Action::HardDrop);
+    }
+
+    // Get the actions reaching a placement from the start position, ending with the hard drop
+    [[nodiscard]] std::vector<Action> get_path(const Placement &placement) const {
+        std::vector<Action> path;
+        for_each_action(placement, [&path](const Action action) { path.push_back(action); });
+        return path;
+    }
+
+private:
+    using Column = std::uint32_t; // One bit per row y of a (rotation, x) column of states
+
+    Shape         shape    = Shape();                        // Shape being searched
+    std::uint16_t start    = 0;                              // State of the start position
+    int           count    = 0;                              // Number of placements
+    int           explored = 0;                              // Number of states reached
+    int           canonical[SHAPE_ROTATIONS];                // First rotation with the same cells as each rotation
+    Column        blocked[SHAPE_ROTATIONS][Bitboard::WIDTH]; // Rows where the shape collides or leaves the board
+    Column        visited[SHAPE_ROTATIONS][Bitboard::WIDTH]; // Rows of the states already reached, by canonical rotation
+    Column        locked[SHAPE_ROTATIONS][Bitboard::WIDTH];  // Rows of the lock positions already found, by canonical rotation
+    std::uint16_t queue[MOVE_GENERATOR_STATES];              // States in breadth-first order
+    std::uint16_t parents[MOVE_GENERATOR_STATES];            // State each state was first reached from
+    Action        moves[MOVE_GENERATOR_STATES];              // Action each state was first reached with
+    Placement     placements[MOVE_GENERATOR_STATES];         // Distinct lock positions, in order of their path length
+
+    static constexpr std::uint16_t encode(const int rotation, const int x, const int y) { return static_cast<std::uint16_t>((rotation * Bitboard::WIDTH + x) * Bitboard::HEIGHT + y); }
+
+    void compute_collisions(const Bitboard &board); // Fill the collision column of every rotation and x
+};
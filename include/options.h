@@ -0,0 +1,17 @@
+#pragma once
+
+#include <charconv>
+#include <cstring>
+#include <system_error>
+
+// Parse a command line value as a number, returns false and leaves the value as it was unless the whole text is a
+// number that fits the type
+template <typename T> bool parse_option(const char *text, T &value) {
+    const char *end    = text + std::strlen(text);
+    T           parsed = {};
+    const auto  result = std::from_chars(text, end, parsed);
+    if (result.ec != std::errc() || result.ptr != end || end == text) { return false; }
+
+    value = parsed;
+    return true;
+}
@@ -1,14 +1,94 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <random>
 #include <type_traits>
 
+// xoshiro256** generator (Blackman & Vigna): 32 bytes of state, a period of 2^256 - 1, and jumps of 2^128 / 2^192 steps
+// to split one seed into non-overlapping streams. Produces the same sequence on every platform.
+class Xoshiro256 {
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr Xoshiro256() : Xoshiro256(0) {}
+    constexpr explicit Xoshiro256(const std::uint64_t seed) { this->seed(seed); }
+
+    // Get the generator of a parallel stream: the seeded sequence advanced by index jumps of 2^128 steps
+    static constexpr Xoshiro256 stream(const std::uint64_t seed, const std::uint64_t index) {
+        Xoshiro256 engine(seed);
+        for (std::uint64_t i = 0; i < index; ++i) { engine.jump(); }
+        return engine;
+    }
+
+    // Reset the state from a seed, expanded with splitmix64 so that close seeds give unrelated sequences
+    constexpr void seed(std::uint64_t seed) {
+        for (auto &word : state) {
+            seed += 0x9E3779B97F4A7C15ull;
+            auto z = seed;
+            z      = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z      = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word   = z ^ (z >> 31);
+        }
+    }
+
+    constexpr result_type operator()() {
+        const auto result = rotl(state[1] * 5, 7) * 9;
+        const auto t      = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    constexpr void jump() { jump_by({0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull}); }      // Advance 2^128 steps
+    constexpr void long_jump() { jump_by({0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull}); } // Advance 2^192 steps
+
+    constexpr bool operator==(const Xoshiro256 &other) const = default;
+
+private:
+    std::uint64_t state[4] = {}; // Generator state, never all zero once seeded
+
+    static constexpr std::uint64_t rotl(const std::uint64_t value, const int shift) { return value << shift | value >> (64 - shift); }
+
+    constexpr void jump_by(const std::uint64_t (&polynomial)[4]) {
+        std::uint64_t jumped[4] = {};
+        for (const auto word : polynomial) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (word & std::uint64_t{1} << bit) {
+                    for (int i = 0; i < 4; ++i) { jumped[i] ^= state[i]; }
+                }
+                (*this)();
+            }
+        }
+        for (int i = 0; i < 4; ++i) { state[i] = jumped[i]; }
+    }
+};
+
 class Random {
 public:
-    // Returns a random integer in the range [min, max)
+    // Returns a random integer in the range [min, max]
     template<typename IntType>
     static IntType int_in_range(const IntType min, const IntType max) {
         static_assert(std::is_integral_v<IntType>, "IntType must be integral");
+
+        // Ranges of fewer than 2^32 values take the bounded fast path, wider ones fall back to the standard distribution.
+        // The span and the offset are computed unsigned, where a range as wide as the whole type cannot overflow.
+        using Unsigned  = std::make_unsigned_t<IntType>;
+        const auto span = static_cast<Unsigned>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min));
+        if (span < std::numeric_limits<std::uint32_t>::max()) {
+            return static_cast<IntType>(static_cast<Unsigned>(static_cast<Unsigned>(min) + bounded(engine(), static_cast<std::uint32_t>(span) + 1)));
+        }
+
         std::uniform_int_distribution<IntType> dist(min, max);
         return dist(engine());
     }
@@ -33,12 +113,49 @@ public:
 
     // Shuffles the elements in the range [first, last)
     template<typename RandomIt>
-    static void shuffle(RandomIt first, RandomIt last) { std::shuffle(first, last, engine()); }
+    static void shuffle(RandomIt first, RandomIt last) { shuffle(first, last, engine()); }
+
+    // Shuffles the elements in the range [first, last) with the given engine, identically on every platform
+    template<typename RandomIt, typename Engine>
+    static void shuffle(RandomIt first, RandomIt last, Engine &engine) {
+        for (auto i = last - first - 1; i > 0; --i) { std::iter_swap(first + i, first + bounded(engine, static_cast<std::uint32_t>(i + 1))); }
+    }
+
+    // Returns an unbiased random integer in the range [0, bound) (Lemire's multiply-shift, the division only runs on the rare rejection path)
+    template<typename Engine>
+    static std::uint32_t bounded(Engine &engine, const std::uint32_t bound) {
+        auto product  = std::uint64_t{bits32(engine)} * bound;
+        auto fraction = static_cast<std::uint32_t>(product);
+        if (fraction < bound) {
+            const std::uint32_t threshold = (0u - bound) % bound; // 2^32 mod bound, the size of the biased tail
+            while (fraction < threshold) {
+                product  = std::uint64_t{bits32(engine)} * bound;
+                fraction = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    // Returns a random seed from the system entropy source
+    static std::uint64_t entropy() {
+        std::random_device device;
+        return static_cast<std::uint64_t>(device()) << 32 | device();
+    }
+
+    // Reseeds the generator of the calling thread, making its following results reproducible
+    static void seed(const std::uint64_t seed) { engine().seed(seed); }
 
 private:
     // Returns a reference to a thread-local random number generator
-    static std::mt19937 &engine() {
-        thread_local static std::mt19937 rng{std::random_device{}()};
+    static Xoshiro256 &engine() {
+        thread_local static Xoshiro256 rng{entropy()};
         return rng;
     }
+
+    // Returns 32 random bits, the upper ones of 64-bit engines (the strongest bits of xoshiro256**)
+    template<typename Engine>
+    static std::uint32_t bits32(Engine &engine) {
+        if constexpr (Engine::max() > std::numeric_limits<std::uint32_t>::max()) { return static_cast<std::uint32_t>(engine() >> 32); }
+        else { return static_cast<std::uint32_t>(engine()); }
+    }
 };
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "bitboard.h"
+#include "colors.h"
+#include "framebuffer.h"
+#include "keys.h"
+#include "shape.h"
+#include "vec2.h"
+#include "rect.h"
+
+// Target of all drawing: a frame of cells with the drawing primitives, pushed to the terminal by a backend. The
+// primitives only write the frame, so the backend is reached through a virtual call once per frame, not per cell.
+class Renderer {
+public:
+    Renderer()          = default;
+    virtual ~Renderer() = default;
+
+    Renderer(const Renderer &)            = delete;
+    Renderer &operator=(const Renderer &) = delete;
+
+    virtual void init() {}      // Initialize the backend
+    virtual void terminate() {} // Restore the terminal as it was before init
+
+    virtual bool wait_input(std::chrono::milliseconds timeout); // Block until input is pending or the timeout expires
+    virtual int  read_key() { return KEY_CODE_NONE; }            // Read one pending key as a KEY_CODE_* or character, KEY_CODE_NONE if none
+
+    [[nodiscard]] virtual bool is_drawn() const { return true; } // Check if frames are shown at all, drawing can be skipped otherwise
+
+    void update();                  // Start a frame, following the size of the terminal
+    void clear() { frame.clear(); } // Clear the frame
+    void refresh();                 // Push the changed cells to the terminal
+
+    [[nodiscard]] int                get_changed_cells() const { return frame.get_changed_cells(); } // Get the number of cells changed by the last refresh
+    [[nodiscard]] const FrameBuffer &get_frame() const { return frame; }                          // Get the frame being drawn
+
+    [[nodiscard]] int  get_width() const { return size.x; }   // Get the width of the terminal screen
+    [[nodiscard]] int  get_height() const { return size.y; }  // Get the height of the terminal screen
+    [[nodiscard]] Vec2 get_size() const { return size; }      // Get the size of the terminal screen
+    [[nodiscard]] bool is_resized() const { return resized; } // Check if the terminal has been resized
+
+    void set_color(Colors color, bool inverted = false); // Set the color for drawing
+
+    void draw_pixel(int x, int y, wchar_t symbol);                                               // Draw a pixel at the specified coordinates
+    void draw_pixel(const Vec2 &pos, const wchar_t symbol) { draw_pixel(pos.x, pos.y, symbol); } // Draw a pixel at the specified position
+
+    void draw_char(int x, int y, wchar_t symbol);                                        // Draw a character at the specified coordinates
+    void draw_char(const Vec2 &pos, wchar_t symbol) { draw_char(pos.x, pos.y, symbol); } // Draw a character at the specified position
+
+    void draw_pixel_line(const Vec2 &start, const Vec2 &end, wchar_t symbol); // Draw a line on the terminal screen
+    void draw_line(const Vec2 &start, const Vec2 &end, wchar_t symbol);       // Draw a line between two points
+
+    void draw_box(const Vec2 &min, const Vec2 &max, wchar_t symbol);                                                          // Draw a filled box between two points
+    void draw_box(const Rect &rect, const wchar_t symbol) { draw_box(rect.get_left_top(), rect.get_right_bottom(), symbol); } // Draw a filled box around a rectangle
+
+    void draw_border(const Vec2 &min, const Vec2 &max);                                               // Draw a border around the specified area
+    void draw_border(const Rect &rect) { draw_border(rect.get_left_top(), rect.get_right_bottom()); } // Draw a border around a rectangle
+    void draw_text(const Vec2 &pos, const wchar_t *str);                                              // Draw text at the specified position
+
+    void draw_grid(const GameGrid &grid, Vec2 origin);            // Draw the game grid
+    void draw_shape(const Shape &shape, Vec2 pos, bool is_shadow); // Draw a shape at the specified position
+
+protected:
+    FrameBuffer frame; // Cells of the frame being drawn and of the frame on the terminal
+
+    [[nodiscard]] virtual Vec2 query_size() = 0; // Get the current size of the terminal
+    virtual int                present()    = 0; // Push the changed cells of the frame, returns their number
+    virtual void               on_resize() {}    // Forget what the terminal shows, before a redraw of every cell
+
+    static bool poll_input(int input, std::chrono::milliseconds timeout); // Block until a file descriptor is readable or the timeout expires
+
+private:
+    bool  resized   = false;                               // Flag to indicate if the terminal has been resized
+    Vec2  size      = Vec2();                              // Size of the terminal screen
+    short color     = static_cast<short>(Colors::Default); // Current color for drawing
+    bool  overbound = false;                               // Flag to indicate if the drawing is overbound
+
+    void put_cell(int x, int y, wchar_t symbol); // Write a cell of the current frame with the current color
+};
+
+// Renderer that shows nothing, for runs at full speed: the scene is not even drawn and input is never waited for
+class NullRenderer final : public Renderer {
+public:
+    bool               wait_input(std::chrono::milliseconds) override { return false; }
+    [[nodiscard]] bool is_drawn() const override { return false; }
+
+protected:
+    [[nodiscard]] Vec2 query_size() override { return Vec2(); }
+    int                present() override { return 0; }
+};
+
+// Renderer keeping the frame in memory, so frames can be inspected and benchmarked without a terminal
+class MemoryRenderer final : public Renderer {
+public:
+    explicit MemoryRenderer(const Vec2 &size) : screen_size(size) {}
+
+    void set_size(const Vec2 &new_size) { screen_size = new_size; } // Resize the screen, applied by the next update
+
+    [[nodiscard]] unsigned long get_frames() const { return frames; }                             // Get the number of refreshes
+    [[nodiscard]] const Cell   &get_cell(const int x, const int y) const { return frame(x, y); } // Get a cell of the last frame
+    [[nodiscard]] std::wstring  get_text() const;                                                // Get the glyphs of the last frame, one line per row
+
+protected:
+    [[nodiscard]] Vec2 query_size() override { return screen_size; }
+    int                present() override {
+        ++frames;
+        return frame.flush([](int, int, const Cell *, int) {});
+    }
+
+private:
+    Vec2          screen_size; // Size of the screen (in cells)
+    unsigned long frames = 0;  // Number of refreshes
+};
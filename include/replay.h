@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "game.h"
+
+// Replay file layout (all integers little endian):
+//   header  "TTRP", version (1 byte), seed (8 bytes)
+//   events  varint(tick_delta << 3 | code), code 0-5 is an Action applied after tick_delta more gravity ticks
+//   end     varint(tick_delta << 3 | REPLAY_END) followed by the checksum of the final game state (8 bytes)
+constexpr char          REPLAY_MAGIC[4]    = {'T', 'T', 'R', 'P'}; // File signature
+constexpr unsigned char REPLAY_VERSION     = 2;                    // Format version, bumped on any change of the rules or the shape generator
+constexpr int           REPLAY_HEADER_SIZE = 4 + 1 + 8;            // Size of the header (in bytes)
+constexpr unsigned int  REPLAY_CODE_BITS   = 3;                    // Number of bits of the event code
+constexpr unsigned int  REPLAY_END         = 7;                    // Event code of the end marker
+
+// Outcome of a replay playback
+struct ReplayResult {
+    unsigned long             actions           = 0;  // Number of actions applied
+    unsigned int              ticks             = 0;  // Number of gravity ticks applied
+    std::uint64_t             checksum          = 0;  // Checksum of the final game state
+    std::uint64_t             expected_checksum = 0;  // Checksum stored in the replay
+    bool                      overrun           = false; // Flag set when events went on past the game over, playback then stopped
+    std::chrono::nanoseconds  elapsed           = {}; // Time spent driving the rules
+
+    [[nodiscard]] bool is_valid() const { return !overrun && checksum == expected_checksum; } // Check if the playback reproduced the recorded game
+};
+
+// Recorded game: the seed of the shape generator and the encoded event stream
+class Replay {
+public:
+    static Replay load(const std::string &path);                  // Read a replay file, throws std::runtime_error when it is malformed
+    static Replay parse(const std::vector<unsigned char> &bytes); // Decode a replay from memory, throws std::runtime_error when it is malformed
+
+    [[nodiscard]] std::uint64_t get_seed() const { return seed; }         // Get the seed of the shape generator
+    [[nodiscard]] std::size_t   get_stream_size() const { return size; } // Get the size of the event stream (in bytes)
+
+    // Play every event at full speed without rendering or sleeping, starting a new game
+    ReplayResult play(Game &game) const;
+
+private:
+    std::uint64_t              seed  = 0;  // Seed of the shape generator
+    std::vector<unsigned char> bytes = {}; // Whole replay, header included
+    std::size_t                size  = 0;  // Size of the event stream (in bytes)
+};
+
+// Appends the actions of a game being played to a replay file, through a buffer flushed every few kilobytes
+class ReplayWriter {
+public:
+    static constexpr std::size_t BUFFER_SIZE = 4096; // Number of bytes buffered before writing to the file
+
+    ReplayWriter() = default;
+    ~ReplayWriter() { close(); }
+
+    ReplayWriter(const ReplayWriter &)            = delete;
+    ReplayWriter &operator=(const ReplayWriter &) = delete;
+
+    void open(const std::string &path, std::uint64_t seed); // Start a replay file, throws std::runtime_error when it cannot be created
+    void record(Action action, unsigned int tick);          // Append an action that changed the game state at the given tick
+    bool finish(const Game &game);                          // Append the end marker and the final checksum, then close the file, returns false if the file was not fully written
+    bool close();                                           // Flush and close the file without an end marker, returns false if the file was not fully written
+
+    [[nodiscard]] bool is_open() const { return file != nullptr; } // Check if a replay is being written
+
+private:
+    std::FILE *                file      = nullptr; // Replay file
+    std::vector<unsigned char> buffer    = {};      // Bytes not written to the file yet
+    unsigned int               last_tick = 0;       // Tick of the last recorded event
+    bool                       failed    = false;   // Flag set when a write to the file fell short
+
+    void write_event(unsigned int code, unsigned int tick);
+    void write_varint(std::uint64_t value);
+    void write_u64(std::uint64_t value);
+    void flush();
+};
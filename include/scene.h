@@ -0,0 +1,21 @@
+#pragma once
+
+#include "game.h"
+#include "metrics.h"
+#include "renderer.h"
+
+// Layout of the game screen: the grid and its shapes centered, the held shape and the metrics overlay on its left
+class Scene {
+public:
+    bool show_metrics = false; // Flag to draw the metrics overlay
+
+    void draw(Renderer &renderer, const Game &game); // Draw the game into the frame of a renderer
+
+private:
+    Shape last_held_shape = Shape(); // Held shape drawn during the last frame
+    bool  metrics_drawn   = false;   // Metrics overlay drawn during the last frame
+
+    void draw_metrics(Renderer &renderer, const Vec2 &hud_origin) const; // Draw the phase percentiles and counters of the loop
+
+    static constexpr int HUD_HEIGHT = PHASE_COUNT + 4; // Height of the metrics overlay (in cells)
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "ansi-renderer.h"
+#include "game.h"
+#include "random.h"
+#include "scene.h"
+#include "telnet.h"
+
+#include "configs/constants.h"
+
+// One remote player: a game, its screen and the telnet stream, without any socket. The owner feeds received bytes,
+// ticks gravity and sends the output queue. A frame is only encoded once the client took everything sent before, so
+// a slow client gets fewer frames carrying the same final state instead of a growing backlog.
+class Session {
+public:
+    explicit Session(std::uint64_t seed);
+
+    void receive(std::string_view bytes); // Handle bytes from the client: telnet commands and keys
+    void tick();                          // Advance gravity by one tick, starting a new game after a game over
+    bool render();                        // Queue a frame of what changed, returns false if deferred by unsent output
+
+    [[nodiscard]] std::string_view get_output() const { return std::string_view(output).substr(output_start); } // Get the bytes waiting to be sent
+    void                           consume(std::size_t count);                                                  // Drop bytes that were sent
+
+    [[nodiscard]] bool          is_dirty() const { return dirty; }               // Check if the screen needs a frame
+    [[nodiscard]] bool          is_closed() const { return closed; }             // Check if the client quit, the output is its last
+    [[nodiscard]] bool          is_overflowing() const;                          // Check if the client left too much output unread
+    [[nodiscard]] const Game   &get_game() const { return game; }                // Get the game being played
+    [[nodiscard]] Vec2          get_screen_size() const { return screen_size; }  // Get the size of the client screen (in cells)
+    [[nodiscard]] unsigned long get_frames() const { return frames; }            // Get the number of frames queued
+    [[nodiscard]] unsigned long get_deferred_frames() const { return deferred; } // Get the number of frames deferred by unsent output
+    [[nodiscard]] unsigned int  get_games() const { return games; }              // Get the number of games started
+
+private:
+    Game           game;                                                          // Game being played
+    Scene          scene;                                                         // Layout of the screen
+    TelnetParser   telnet;                                                        // Parser of the received stream
+    Xoshiro256     seeds;                                                         // Seeds of the games played
+    Vec2           screen_size = Vec2(SERVER_SCREEN_WIDTH, SERVER_SCREEN_HEIGHT); // Size of the client screen (in cells)
+    StreamRenderer renderer    = StreamRenderer(screen_size);                     // Encoder of the frames
+
+    std::string output       = {}; // Bytes queued for the client
+    std::size_t output_start = 0;  // Offset of the first byte not sent yet
+    std::string keys         = {}; // Data bytes received and not decoded yet, a cut escape sequence
+
+    bool          dirty    = true;  // Flag set when the game or the screen changed since the last frame
+    bool          closed   = false; // Flag set when the client quit
+    unsigned long frames   = 0;     // Number of frames queued
+    unsigned long deferred = 0;     // Number of frames deferred by unsent output
+    unsigned int  games    = 0;     // Number of games started
+
+    void new_game();          // Start the next game of the session
+    void handle_key(int key); // Apply a key to the game
+};
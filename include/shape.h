@@ -1,66 +1,123 @@
 #ifndef SHAPE_H
 #define SHAPE_H
 
-#include "board-matrix.h"
-#include "vec2.h"
-#include "vector"
+#include <array>
 #include <stdexcept>
+#include <type_traits>
+
+#include "bitboard.h"
+#include "configs/constants.h"
+#include "vec2.h"
+
+constexpr int SHAPE_COUNT     = 7; // Number of different shapes
+constexpr int SHAPE_ROTATIONS = 4; // Number of rotation states of every shape
+constexpr int SHAPE_MAX_SIZE  = 4; // Maximum width/height of a shape bounding box
+
+static_assert(SHAPE_MAX_SIZE <= BITBOARD_SHAPE_ROWS, "Shape masks must fit into a ShapeMask");
+
+struct ShapeRotation {
+    unsigned char blocks[SHAPE_MAX_SIZE][SHAPE_MAX_SIZE]; // Block values of the rotation state, indexed [y][x]
+    ShapeMask     mask;                                   // Occupancy rows of the rotation state
+    Vec2          size;                                   // Size of the bounding box
+    Vec2          offset;                                 // Spawn position of the bounding box in the game grid
+    signed char   top[SHAPE_MAX_SIZE];                    // Topmost block row of every column (-1 for empty columns)
+    signed char   bottom[SHAPE_MAX_SIZE];                 // Bottommost block row of every column (-1 for empty columns)
+};
+
+using ShapeTable = std::array<std::array<ShapeRotation, SHAPE_ROTATIONS>, SHAPE_COUNT>;
+
+// Build a rotation state from its blocks, filling in the derived fields
+constexpr ShapeRotation make_shape_rotation(const ShapeRotation &source) {
+    ShapeRotation rotation = source;
+    rotation.mask          = {};
+    for (int y = 0; y < rotation.size.y; ++y) {
+        for (int x = 0; x < rotation.size.x; ++x) {
+            if (rotation.blocks[y][x] != 0) { rotation.mask[y] |= BitRow{1} << x; }
+        }
+    }
+    rotation.offset = Vec2(GAME_GRID_WIDTH / 2 - rotation.size.x / 2, 0);
+    for (int x = 0; x < SHAPE_MAX_SIZE; ++x) {
+        rotation.top[x]    = -1;
+        rotation.bottom[x] = -1;
+        for (int y = 0; y < rotation.size.y && x < rotation.size.x; ++y) {
+            if (rotation.blocks[y][x] == 0) { continue; }
+            if (rotation.top[x] < 0) { rotation.top[x] = static_cast<signed char>(y); }
+            rotation.bottom[x] = static_cast<signed char>(y);
+        }
+    }
+    return rotation;
+}
+
+// Rotate a rotation state 90 degrees clockwise (same layout as BoardMatrix::rotate_clockwise)
+constexpr ShapeRotation rotate_shape_clockwise(const ShapeRotation &source) {
+    ShapeRotation rotated{};
+    rotated.size = Vec2(source.size.y, source.size.x);
+    for (int y = 0; y < source.size.y; ++y) {
+        for (int x = 0; x < source.size.x; ++x) { rotated.blocks[x][source.size.y - 1 - y] = source.blocks[y][x]; }
+    }
+    return make_shape_rotation(rotated);
+}
+
+// Generate all rotation states of the given base shapes
+constexpr ShapeTable make_shape_table(const std::array<ShapeRotation, SHAPE_COUNT> &base) {
+    ShapeTable table{};
+    for (int shape = 0; shape < SHAPE_COUNT; ++shape) {
+        table[shape][0] = make_shape_rotation(base[shape]);
+        for (int rotation = 1; rotation < SHAPE_ROTATIONS; ++rotation) { table[shape][rotation] = rotate_shape_clockwise(table[shape][rotation - 1]); }
+    }
+    return table;
+}
 
 struct Shape {
-    // Define the shapes using a 2D vector of unsigned char
-    inline static const std::vector<std::vector<std::vector<unsigned char> > > SHAPES = {
+    // Define the shapes in their spawn orientation
+    static constexpr std::array<ShapeRotation, SHAPE_COUNT> SHAPES = {{
         // I shape
-        {
-            {1, 1, 1, 1}
-        },
+        {{{1, 1, 1, 1}}, {}, Vec2(4, 1), {}, {}, {}},
         // J shape
-        {
-            {2, 2, 2},
-            {0, 0, 2}
-        },
+        {{{2, 2, 2}, {0, 0, 2}}, {}, Vec2(3, 2), {}, {}, {}},
         // L shape
-        {
-            {3, 3, 3},
-            {3, 0, 0}
-        },
+        {{{3, 3, 3}, {3, 0, 0}}, {}, Vec2(3, 2), {}, {}, {}},
         // O shape
-        {
-            {4, 4},
-            {4, 4}
-        },
+        {{{4, 4}, {4, 4}}, {}, Vec2(2, 2), {}, {}, {}},
         // S shape
-        {
-            {5, 5, 0},
-            {0, 5, 5}
-        },
+        {{{5, 5, 0}, {0, 5, 5}}, {}, Vec2(3, 2), {}, {}, {}},
         // T shape
-        {
-            {6, 6, 6},
-            {0, 6, 0}
-        },
+        {{{6, 6, 6}, {0, 6, 0}}, {}, Vec2(3, 2), {}, {}, {}},
         // Z shape
-        {
-            {0, 7, 7},
-            {7, 7, 0}
-        }
-    };
+        {{{0, 7, 7}, {7, 7, 0}}, {}, Vec2(3, 2), {}, {}, {}},
+    }};
+
+    // All rotation states of every shape, generated at compile time
+    static constexpr ShapeTable ROTATIONS = make_shape_table(SHAPES);
 
-    Vec2                       position; // Position of the shape in the game grid
-    BoardMatrix<unsigned char> blocks;   // Shape structure;
+    static constexpr unsigned char NONE = 0xFF; // Type of an empty shape
 
-    explicit Shape(const unsigned int shape_index) {
-        if (shape_index >= SHAPES.size()) { throw std::out_of_range("Invalid shape index"); }
+    static constexpr ShapeRotation EMPTY_ROTATION = make_shape_rotation({}); // Rotation state of an empty shape, with no blocks
 
-        position = Vec2(0, 0);
+    Vec2          position; // Position of the shape in the game grid
+    unsigned char type;     // Index of the shape in ROTATIONS
+    unsigned char rotation; // Index of the current rotation state
 
-        const auto &shape = SHAPES[shape_index];
-        blocks            = BoardMatrix<unsigned char>(static_cast<int>(shape[0].size()), static_cast<int>(shape.size()));
-        for (int y = 0; y < shape.size(); ++y) { for (int x = 0; x < shape[y].size(); ++x) { blocks(x, y) = shape[y][x]; } }
+    constexpr explicit Shape(const unsigned int shape_index) : position(Vec2(0, 0)), type(static_cast<unsigned char>(shape_index)), rotation(0) {
+        if (shape_index >= SHAPE_COUNT) { throw std::out_of_range("Invalid shape index"); }
     }
-    explicit Shape() : position(Vec2(0, 0)), blocks(BoardMatrix<unsigned char>(0, 0)) {}
+    constexpr explicit Shape() : position(Vec2(0, 0)), type(NONE), rotation(0) {}
+
+    [[nodiscard]] const ShapeRotation &get_rotation() const { return is_valid() ? ROTATIONS[type][rotation] : EMPTY_ROTATION; } // Get the current rotation state
+    [[nodiscard]] const ShapeMask &    get_mask() const { return get_rotation().mask; }                   // Get the occupancy rows of the shape
+    [[nodiscard]] Vec2                 get_size() const { return get_rotation().size; }                   // Get the size of the bounding box
+    [[nodiscard]] Vec2                 get_spawn_position() const { return get_rotation().offset; }       // Get the spawn position in the game grid
+    [[nodiscard]] unsigned char        get_block(const int x, const int y) const { return get_rotation().blocks[y][x]; } // Get a block value
+    [[nodiscard]] bool                 is_valid() const { return type != NONE; }                          // Check if the shape is not empty
 
-    [[nodiscard]] Vec2 get_size() const { return Vec2(blocks.get_width(), blocks.get_height()); }
-    [[nodiscard]] bool is_valid() const { return !blocks.is_empty(); }
+    // Return the same shape rotated 90 degrees clockwise
+    [[nodiscard]] Shape rotated_clockwise() const {
+        Shape rotated    = *this;
+        rotated.rotation = static_cast<unsigned char>((rotation + 1) % SHAPE_ROTATIONS);
+        return rotated;
+    }
 };
 
+static_assert(std::is_trivially_copyable_v<Shape>, "Shape must stay trivially copyable");
+
 #endif //SHAPE_H
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "vec2.h"
+
+constexpr unsigned char TELNET_SE   = 240; // End of subnegotiation
+constexpr unsigned char TELNET_SB   = 250; // Start of subnegotiation
+constexpr unsigned char TELNET_WILL = 251; // Sender wants to enable an option
+constexpr unsigned char TELNET_WONT = 252; // Sender refuses or disables an option
+constexpr unsigned char TELNET_DO   = 253; // Sender asks the receiver to enable an option
+constexpr unsigned char TELNET_DONT = 254; // Sender asks the receiver to disable an option
+constexpr unsigned char TELNET_IAC  = 255; // Interpret as command, doubled for a data byte 255
+
+constexpr unsigned char TELNET_OPTION_ECHO = 1;  // Echo (RFC 857), the server echoes so the client does not
+constexpr unsigned char TELNET_OPTION_SGA  = 3;  // Suppress go-ahead (RFC 858), keys are sent one by one
+constexpr unsigned char TELNET_OPTION_NAWS = 31; // Negotiate about window size (RFC 1073)
+
+constexpr int TELNET_SUBNEGOTIATION_BYTES = 16; // Longest subnegotiation kept, longer ones are cut
+
+// Parser of a telnet stream (RFC 854): splits the data bytes from the commands, refuses the options the server does
+// not offer and reads the window size. A plain socket client never sends commands, so it is only data.
+class TelnetParser {
+public:
+    static constexpr std::string_view GREETING = "\xff\xfb\x01\xff\xfb\x03\xff\xfd\x1f"; // IAC WILL ECHO, IAC WILL SGA, IAC DO NAWS
+
+    void feed(std::string_view bytes, std::string &data, std::string &replies); // Parse received bytes, appending data bytes and replies
+
+    [[nodiscard]] Vec2 get_window() const { return window; } // Get the window size sent by the client, zero until then
+
+private:
+    enum class State : unsigned char {
+        Data,           // Data bytes
+        Command,        // After IAC
+        Option,         // After IAC and an option verb
+        Subnegotiation, // Inside IAC SB
+        SubCommand,     // After IAC inside a subnegotiation
+    };
+
+    State         state  = State::Data; // Position in the current command
+    unsigned char verb   = 0;           // Option verb being parsed
+    Vec2          window = Vec2();      // Window size sent by the client
+
+    unsigned char sub[TELNET_SUBNEGOTIATION_BYTES] = {}; // Bytes of the subnegotiation being parsed
+    int           sub_length                       = 0;  // Number of subnegotiation bytes kept
+
+    void negotiate(unsigned char option, std::string &replies) const; // Answer an option verb
+    void subnegotiate();                                               // Apply a finished subnegotiation
+};
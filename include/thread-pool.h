@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool: every worker owns a queue, runs its newest task first and steals the oldest
+// task of another worker when its own queue is empty, so uneven tasks keep every core busy
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(const unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency())) {
+        for (unsigned int i = 0; i < thread_count; ++i) { workers.push_back(std::make_unique<Worker>()); }
+        for (unsigned int i = 0; i < thread_count; ++i) { threads.emplace_back(&ThreadPool::run, this, i); }
+    }
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto &thread : threads) { thread.join(); }
+    }
+
+    ThreadPool(const ThreadPool &)            = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    [[nodiscard]] unsigned int  get_thread_count() const { return static_cast<unsigned int>(threads.size()); } // Get the number of workers
+    [[nodiscard]] unsigned long get_steals() const { return steals; }                                          // Get the number of tasks run by another worker than the one they were queued on
+
+    // Queue a task, on the calling worker when called from a task, otherwise spread over the workers
+    void submit(Task task) {
+        const auto index = current_pool == this ? current_index : next_queue++ % workers.size();
+        ++pending;
+        {
+            std::lock_guard lock(workers[index]->mutex);
+            workers[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard lock(sleep_mutex);
+            ++queued;
+        }
+        wake.notify_one();
+    }
+
+    // Block until every submitted task has finished
+    void wait() {
+        std::unique_lock lock(sleep_mutex);
+        idle.wait(lock, [this] { return pending == 0; });
+    }
+
+private:
+    struct Worker {
+        std::mutex       mutex; // Guard of the queue
+        std::deque<Task> tasks; // Queued tasks, the owner takes from the back and thieves from the front
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;            // Queue of every worker
+    std::vector<std::thread>             threads;            // Thread of every worker
+    std::atomic<unsigned long>           pending    = 0;     // Number of submitted tasks not finished yet
+    std::atomic<unsigned long>           queued     = 0;     // Number of submitted tasks not started yet
+    std::atomic<unsigned long>           steals     = 0;     // Number of stolen tasks
+    std::atomic<unsigned int>            next_queue = 0;     // Queue of the next task submitted from outside the pool
+    bool                                 stopping   = false; // Flag to let the workers exit once the queues are empty
+
+    std::mutex              sleep_mutex; // Guard of the sleeping workers and waiters
+    std::condition_variable wake;        // Signaled when a task is queued or the pool stops
+    std::condition_variable idle;        // Signaled when the last pending task finishes
+
+    inline static thread_local ThreadPool *current_pool  = nullptr; // Pool of the calling worker thread
+    inline static thread_local std::size_t current_index = 0;       // Index of the calling worker thread
+
+    void run(const unsigned int index) {
+        current_pool  = this;
+        current_index = index;
+
+        while (true) {
+            Task task;
+            if (!pop(index, task) && !steal(index, task)) {
+                std::unique_lock lock(sleep_mutex);
+                wake.wait(lock, [this] { return stopping || queued > 0; });
+                if (stopping && queued == 0) { return; }
+                continue;
+            }
+
+            --queued;
+            task();
+
+            if (--pending == 0) {
+                std::lock_guard lock(sleep_mutex);
+                idle.notify_all();
+            }
+        }
+    }
+
+    bool pop(const std::size_t index, Task &task) {
+        auto &worker = *workers[index];
+
+        std::lock_guard lock(worker.mutex);
+        if (worker.tasks.empty()) { return false; }
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(const std::size_t index, Task &task) {
+        for (std::size_t offset = 1; offset < workers.size(); ++offset) {
+            auto &victim = *workers[(index + offset) % workers.size()];
+
+            std::lock_guard lock(victim.mutex);
+            if (victim.tasks.empty()) { continue; }
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            ++steals;
+            return true;
+        }
+        return false;
+    }
+};
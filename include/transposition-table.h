@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+
+// Value of a hashed state found by a search
+struct TranspositionEntry {
+    float         score = 0; // Value of the state
+    unsigned char depth = 0; // Search depth the value was computed with
+};
+
+// Fixed-size hash table of search results, shared by every search thread without locks. Every slot keeps its
+// data next to key ^ data (Hyatt's XOR trick): a slot torn by two concurrent writers no longer decodes to its key
+// and reads as a miss. Slots are grouped by cache line, the shallowest and oldest slot of a line is replaced first.
+class TranspositionTable {
+public:
+    static constexpr int CLUSTER_SIZE = 4; // Number of slots sharing a cache line
+
+    explicit TranspositionTable(const int clusters_log2 = 16) : clusters(new Cluster[std::size_t{1} << clusters_log2]), mask((std::size_t{1} << clusters_log2) - 1) {}
+
+    [[nodiscard]] std::size_t   get_size() const { return (mask + 1) * CLUSTER_SIZE; }                  // Get the number of slots
+    [[nodiscard]] unsigned long get_probes() const { return probes.load(std::memory_order_relaxed); } // Get the number of lookups
+    [[nodiscard]] unsigned long get_hits() const { return hits.load(std::memory_order_relaxed); }     // Get the number of successful lookups
+    [[nodiscard]] unsigned long get_stores() const { return stores.load(std::memory_order_relaxed); } // Get the number of stored entries
+    [[nodiscard]] double        get_hit_rate() const { return get_probes() == 0 ? 0.0 : static_cast<double>(get_hits()) / get_probes(); }
+
+    // Start a new search, the entries of the previous searches are replaced first
+    void new_search() { age.fetch_add(1, std::memory_order_relaxed); }
+
+    // Look up the entry of a key, returns false when it is not stored
+    bool probe(const std::uint64_t key, TranspositionEntry &entry) const {
+        probes.fetch_add(1, std::memory_order_relaxed);
+
+        for (const auto &slot : clusters[key & mask].slots) {
+            const auto data = slot.data.load(std::memory_order_relaxed);
+            if ((data & VALID) == 0 || (slot.check.load(std::memory_order_relaxed) ^ data) != key) { continue; }
+
+            entry = TranspositionEntry{std::bit_cast<float>(static_cast<std::uint32_t>(data)), static_cast<unsigned char>(data >> 32)};
+            hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    // Store the entry of a key, over the same key or the least valuable slot of its cache line
+    void store(const std::uint64_t key, const TranspositionEntry &entry) {
+        stores.fetch_add(1, std::memory_order_relaxed);
+
+        const auto current = age.load(std::memory_order_relaxed);
+        auto      &cluster = clusters[key & mask];
+
+        Slot *victim       = nullptr;
+        int   victim_value = 0;
+        for (auto &slot : cluster.slots) {
+            const auto data = slot.data.load(std::memory_order_relaxed);
+            if ((data & VALID) == 0 || (slot.check.load(std::memory_order_relaxed) ^ data) == key) {
+                victim = &slot;
+                break;
+            }
+
+            // Every search of age difference weighs as much as a depth of 8
+            const auto slot_age = static_cast<unsigned char>(data >> 40);
+            const auto value    = static_cast<int>(static_cast<unsigned char>(data >> 32)) - 8 * static_cast<unsigned char>(current - slot_age);
+            if (victim == nullptr || value < victim_value) {
+                victim       = &slot;
+                victim_value = value;
+            }
+        }
+
+        const auto data = VALID | static_cast<std::uint64_t>(current) << 40 | static_cast<std::uint64_t>(entry.depth) << 32 | std::bit_cast<std::uint32_t>(entry.score);
+        victim->data.store(data, std::memory_order_relaxed);
+        victim->check.store(key ^ data, std::memory_order_relaxed);
+    }
+
+    // Forget every entry and reset the counters
+    void clear() {
+        for (std::size_t i = 0; i <= mask; ++i) {
+            for (auto &slot : clusters[i].slots) {
+                slot.data.store(0, std::memory_order_relaxed);
+                slot.check.store(0, std::memory_order_relaxed);
+            }
+        }
+        probes = 0;
+        hits   = 0;
+        stores = 0;
+    }
+
+private:
+    static constexpr std::uint64_t VALID = std::uint64_t{1} << 48; // Flag of a written slot
+
+    // Slot data: score bits (0-31), depth (32-39), age (40-47), valid flag (48)
+    struct Slot {
+        std::atomic<std::uint64_t> check = 0; // Key ^ data
+        std::atomic<std::uint64_t> data  = 0; // Packed entry
+    };
+    struct alignas(64) Cluster {
+        Slot slots[CLUSTER_SIZE];
+    };
+
+    std::unique_ptr<Cluster[]>         clusters;   // Slots, grouped by cache line
+    std::size_t                        mask;       // Mask of the cluster index of a key
+    std::atomic<unsigned char>         age    = 0; // Age of the current search
+    mutable std::atomic<unsigned long> probes = 0; // Number of lookups
+    mutable std::atomic<unsigned long> hits   = 0; // Number of successful lookups
+    std::atomic<unsigned long>         stores = 0; // Number of stored entries
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Stack of the last N pushed values: pushing past the capacity overwrites the oldest one, popping returns the newest.
+// Values are copied in and out of fixed storage, so pushing and undoing never allocate.
+template<typename T, std::size_t N>
+class UndoRing {
+    static_assert(N > 0, "An undo ring needs room for one value");
+    static_assert(std::is_trivially_copyable_v<T>, "Undo values are saved with plain copies");
+
+public:
+    [[nodiscard]] static constexpr std::size_t capacity() { return N; }         // Get the number of values kept
+    [[nodiscard]] std::size_t                  size() const { return count; }       // Get the number of values that can be undone
+    [[nodiscard]] bool                         empty() const { return count == 0; } // Check if nothing can be undone
+
+    // Save a value, forgetting the oldest one when full
+    void push(const T &value) {
+        values[head] = value;
+        head         = (head + 1) % N;
+        count        = count < N ? count + 1 : N;
+    }
+
+    // Take back the newest value, returns false when there is none
+    bool pop(T &value) {
+        if (count == 0) { return false; }
+
+        head  = (head + N - 1) % N;
+        value = values[head];
+        --count;
+        return true;
+    }
+
+    void clear() { count = 0; } // Forget every value
+
+private:
+    std::array<T, N> values = {}; // Saved values, oldest overwritten first
+    std::size_t      head   = 0;  // Slot of the next pushed value
+    std::size_t      count  = 0;  // Number of saved values
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#include "bitboard.h"
+#include "shape.h"
+
+// Random keys of every part of a game state, generated at compile time with splitmix64 so every build hashes alike.
+// The hash of a state is the XOR of the keys of its parts, so a change only XORs out the old keys and XORs in the new ones.
+struct ZobristKeys {
+    std::uint64_t cells[Bitboard::HEIGHT][Bitboard::WIDTH]; // Occupied cell
+    std::uint64_t current[SHAPE_COUNT];                     // Type of the current shape
+    std::uint64_t held[SHAPE_COUNT];                        // Type of the held shape
+    std::uint64_t bag[SHAPE_COUNT][SHAPE_COUNT];            // Shape type at an index of the bag
+    std::uint64_t swap_used;                                // Held shape already swapped for the current shape
+    std::uint64_t depth[2];                                 // Search depth of a cached value
+};
+
+constexpr std::uint64_t ZOBRIST_SEED = 0x2B7E151628AED2A6ull; // Seed of the key generator
+
+constexpr ZobristKeys make_zobrist_keys() {
+    ZobristKeys   keys{};
+    std::uint64_t state = ZOBRIST_SEED;
+    const auto    next  = [&state] {
+        state += 0x9E3779B97F4A7C15ull;
+        auto z = state;
+        z      = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z      = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    };
+
+    for (auto &row : keys.cells) { for (auto &key : row) { key = next(); } }
+    for (auto &key : keys.current) { key = next(); }
+    for (auto &key : keys.held) { key = next(); }
+    for (auto &index : keys.bag) { for (auto &key : index) { key = next(); } }
+    keys.swap_used = next();
+    for (auto &key : keys.depth) { key = next(); }
+
+    return keys;
+}
+
+inline constexpr ZobristKeys ZOBRIST = make_zobrist_keys(); // Keys shared by every hash
+
+// Hash of the occupied cells of one row
+constexpr std::uint64_t zobrist_row(const int y, BitRow row) {
+    std::uint64_t hash = 0;
+    for (; row != 0; row &= row - 1) { hash ^= ZOBRIST.cells[y][std::countr_zero(row)]; }
+    return hash;
+}
+
+// Hash of the occupied cells of a board
+constexpr std::uint64_t zobrist_board(const Bitboard &board) {
+    std::uint64_t hash = 0;
+    for (int y = 0; y < Bitboard::HEIGHT; ++y) { hash ^= zobrist_row(y, board.rows[y]); }
+    return hash;
+}
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bot.h"
+#include "game.h"
+#include "histogram.h"
+#include "options.h"
+#include "random.h"
+#include "thread-pool.h"
+#include "transposition-table.h"
+
+// Outcome of one self-play game
+struct GameResult {
+    unsigned int  lines  = 0; // Number of cleared lines
+    unsigned int  pieces = 0; // Number of placed shapes
+    std::uint64_t micros = 0; // Time spent playing (in microseconds)
+};
+
+// Outcome of a whole tournament
+struct Tournament {
+    std::vector<GameResult> results  = {}; // Result of every game, in seed order
+    double                  seconds  = 0;  // Wall time of the tournament
+    unsigned int            threads  = 0;  // Number of workers
+    unsigned long           steals   = 0;  // Number of games stolen between workers
+    double                  hit_rate = 0;  // Hit rate of the shared transposition table, with lookahead
+
+    [[nodiscard]] double get_games_per_second() const { return seconds > 0 ? static_cast<double>(results.size()) / seconds : 0.0; }
+};
+
+// Let the bot play a game until it tops out or reaches the piece limit, searching one shape deeper when given a table
+static GameResult play_game(const std::uint64_t seed, const unsigned int max_pieces, TranspositionTable *table) {
+    using clock = std::chrono::steady_clock;
+
+    const auto started = clock::now();
+
+    Game game;
+    game.init(seed);
+
+    Bot bot(BotWeights(), table != nullptr, table);
+    while (game.get_pieces_placed() < max_pieces && bot.play(game)) {}
+
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - started).count();
+    return GameResult{game.get_lines_cleared(), game.get_pieces_placed(), static_cast<std::uint64_t>(micros)};
+}
+
+// Play every game on a work-stealing pool, game i always gets the same seed whatever the number of threads.
+// With lookahead, every worker shares one transposition table.
+static Tournament run_tournament(const unsigned int games, const unsigned int threads, const std::uint64_t seed, const unsigned int max_pieces, const bool lookahead) {
+    using clock = std::chrono::steady_clock;
+
+    Xoshiro256                 seeds(seed);
+    std::vector<std::uint64_t> game_seeds(games);
+    for (auto &game_seed : game_seeds) { game_seed = seeds(); }
+
+    Tournament tournament;
+    tournament.results.resize(games);
+    tournament.threads = threads;
+
+    std::unique_ptr<TranspositionTable> table;
+    if (lookahead) { table = std::make_unique<TranspositionTable>(); }
+
+    const auto started = clock::now();
+    {
+        ThreadPool pool(threads);
+        for (unsigned int i = 0; i < games; ++i) {
+            pool.submit([&tournament, &game_seeds, &table, i, max_pieces] { tournament.results[i] = play_game(game_seeds[i], max_pieces, table.get()); });
+        }
+        pool.wait();
+        tournament.steals = pool.get_steals();
+    }
+    tournament.seconds = std::chrono::duration<double>(clock::now() - started).count();
+    if (table) { tournament.hit_rate = table->get_hit_rate(); }
+
+    return tournament;
+}
+
+static void print_histogram(const char *name, const Histogram &histogram) {
+    std::printf("  %-12s mean %10.1f  p50 %8llu  p90 %8llu  p99 %8llu  max %8llu\n", name, histogram.get_mean(),
+                static_cast<unsigned long long>(histogram.percentile(50)), static_cast<unsigned long long>(histogram.percentile(90)),
+                static_cast<unsigned long long>(histogram.percentile(99)), static_cast<unsigned long long>(histogram.get_max()));
+}
+
+static void print_tournament(const Tournament &tournament) {
+    Histogram     lines, pieces, micros;
+    std::uint64_t busy_micros = 0, total_pieces = 0;
+    for (const auto &result : tournament.results) {
+        lines.record(result.lines);
+        pieces.record(result.pieces);
+        micros.record(result.micros);
+        busy_micros += result.micros;
+        total_pieces += result.pieces;
+    }
+
+    const auto utilization = static_cast<double>(busy_micros) / (tournament.seconds * 1e6 * tournament.threads);
+
+    std::printf("%zu games on %u threads in %.3f s: %.1f games/s, %.0f pieces/s\n", tournament.results.size(), tournament.threads,
+                tournament.seconds, tournament.get_games_per_second(), static_cast<double>(total_pieces) / tournament.seconds);
+    std::printf("  utilization %.1f%%, %lu games stolen\n", utilization * 100.0, tournament.steals);
+    if (tournament.hit_rate > 0) { std::printf("  transposition table hit rate %.1f%%\n", tournament.hit_rate * 100.0); }
+    print_histogram("lines", lines);
+    print_histogram("pieces", pieces);
+    print_histogram("length (us)", micros);
+}
+
+// Run the same tournament on 1, 2, 4... threads up to the number of cores, and compare with linear scaling
+static void print_scaling(const unsigned int games, const unsigned int max_threads, const std::uint64_t seed, const unsigned int max_pieces, const bool lookahead) {
+    std::vector<unsigned int> thread_counts;
+    for (unsigned int threads = 1; threads < max_threads; threads *= 2) { thread_counts.push_back(threads); }
+    thread_counts.push_back(max_threads);
+
+    std::printf("%8s %12s %10s %11s\n", "threads", "games/s", "speedup", "efficiency");
+
+    double baseline = 0;
+    for (const auto threads : thread_counts) {
+        const auto games_per_second = run_tournament(games, threads, seed, max_pieces, lookahead).get_games_per_second();
+        if (threads == 1) { baseline = games_per_second; }
+
+        const auto speedup = baseline > 0 ? games_per_second / baseline : 0.0;
+        std::printf("%8u %12.1f %9.2fx %10.1f%%\n", threads, games_per_second, speedup, speedup / threads * 100.0);
+    }
+}
+
+int main(const int argc, char **argv) {
+    unsigned int  games      = 1000;                                              // Number of games to play
+    unsigned int  threads    = std::max(1u, std::thread::hardware_concurrency()); // Number of workers
+    unsigned int  max_pieces = 2000;                                              // Piece limit of a game, the bot rarely tops out
+    std::uint64_t seed       = 1;                                                 // Seed of the game seeds
+    bool          scaling    = false;                                             // Sweep the number of threads instead of a single run
+    bool          lookahead  = false;                                             // Search one shape deeper with a shared transposition table
+    for (int i = 1; i < argc; ++i) {
+        bool valid = true;
+        if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], games); }
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], threads); }
+        else if (std::strcmp(argv[i], "--max-pieces") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], max_pieces); }
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], seed); }
+        else if (std::strcmp(argv[i], "--scaling") == 0) { scaling = true; }
+        else if (std::strcmp(argv[i], "--lookahead") == 0) { lookahead = true; }
+        else { valid = false; }
+
+        if (!valid) {
+            std::fprintf(stderr, "usage: %s [--games N] [--threads N] [--max-pieces N] [--seed N] [--scaling] [--lookahead]\n", argv[0]);
+            return 2;
+        }
+    }
+    threads = std::max(1u, threads);
+
+    if (scaling) { print_scaling(games, threads, seed, max_pieces, lookahead); }
+    else { print_tournament(run_tournament(games, threads, seed, max_pieces, lookahead)); }
+}
@@ -0,0 +1,422 @@
+#include "event-loop.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <sys/epoll.h>
+#include <sys/prctl.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+constexpr std::uint64_t EVENT_WAKE  = ~std::uint64_t{0};     // Event tag of the wakeup counter
+constexpr std::uint64_t EVENT_TIMER = ~std::uint64_t{0} - 1; // Event tag of the tick timer
+
+// Epoll tag of a connection: its slot and the generation living there
+static std::uint64_t tag_of(const std::uint32_t slot, const std::uint32_t generation) { return static_cast<std::uint64_t>(generation) << 32 | slot; }
+
+void LoopStats::merge(const LoopStats &other) {
+    accepted += other.accepted;
+    closed += other.closed;
+    dropped += other.dropped;
+    ticks += other.ticks;
+    late += other.late;
+    frames += other.frames;
+    deferred += other.deferred;
+    bytes_in += other.bytes_in;
+    bytes_out += other.bytes_out;
+    sends += other.sends;
+    wakeups += other.wakeups;
+    published += other.published;
+    offered += other.offered;
+    keyframes += other.keyframes;
+    watched += other.watched;
+    jitter.merge(other.jitter);
+}
+
+EventLoop::EventLoop(const std::uint64_t seed) : seeds(seed) {
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    wake_fd  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    epoll_event event = {};
+    event.events      = EPOLLIN;
+    event.data.u64    = EVENT_WAKE;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event);
+    event.data.u64 = EVENT_TIMER;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &event);
+}
+EventLoop::~EventLoop() {
+    stop();
+    for (const auto &socket : adopted) { ::close(socket.fd); }
+    ::close(wake_fd);
+    ::close(timer_fd);
+    ::close(epoll_fd);
+}
+
+void EventLoop::start() {
+    running = true;
+    thread  = std::thread([this] { run(); });
+}
+void EventLoop::stop() {
+    if (!thread.joinable()) { return; }
+
+    running = false;
+    constexpr std::uint64_t one = 1;
+    (void) write(wake_fd, &one, sizeof(one));
+    thread.join();
+}
+
+void EventLoop::adopt(const int fd, const bool spectator) {
+    {
+        std::lock_guard lock(adopt_mutex);
+        adopted.push_back(Adopted{fd, spectator});
+    }
+    constexpr std::uint64_t one = 1;
+    (void) write(wake_fd, &one, sizeof(one));
+}
+void EventLoop::measure(const bool enabled) { measuring.store(enabled, std::memory_order_relaxed); }
+
+void EventLoop::run() {
+    // The kernel may delay a timer by the slack of its thread (50 us by default) to batch wakeups, all of it jitter here
+    prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+
+    epoll_event events[SERVER_EPOLL_EVENTS];
+    while (running.load(std::memory_order_relaxed)) {
+        const int count = epoll_wait(epoll_fd, events, SERVER_EPOLL_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) { continue; }
+            std::perror("epoll_wait");
+            break;
+        }
+        if (is_measuring()) { ++stats.wakeups; }
+
+        for (int i = 0; i < count; ++i) {
+            const auto tag = events[i].data.u64;
+            if (tag == EVENT_WAKE) {
+                std::uint64_t value;
+                (void) read(wake_fd, &value, sizeof(value));
+                register_adopted();
+            } else if (tag == EVENT_TIMER) {
+                std::uint64_t expirations;
+                (void) read(timer_fd, &expirations, sizeof(expirations));
+                run_ticks();
+            } else {
+                const auto slot = static_cast<std::uint32_t>(tag);
+                if (auto *connection = find(slot, static_cast<std::uint32_t>(tag >> 32))) { handle_socket(*connection, events[i].events); }
+
+                // A batch of keys can take milliseconds to draw, ticks falling due meanwhile go first
+                if (!deadlines.empty() && deadlines.top().time <= ServerClock::now()) { run_ticks(); }
+            }
+        }
+        arm_timer();
+    }
+
+    for (std::uint32_t slot = 0; slot < connections.size(); ++slot) {
+        if (connections[slot]) { close_connection(slot, false); }
+    }
+}
+
+void EventLoop::register_adopted() {
+    std::vector<Adopted> sockets;
+    {
+        std::lock_guard lock(adopt_mutex);
+        sockets.swap(adopted);
+    }
+
+    const auto now = ServerClock::now();
+    for (const auto [fd, spectator] : sockets) {
+        std::uint32_t slot;
+        if (!free_slots.empty()) {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        } else {
+            slot = static_cast<std::uint32_t>(connections.size());
+            connections.emplace_back();
+        }
+
+        const auto generation = ++generations;
+        connections[slot]     = std::make_unique<Connection>(fd, slot, generation);
+        auto &connection      = *connections[slot];
+        if (is_measuring()) { ++stats.accepted; }
+
+        epoll_event event = {};
+        event.events      = EPOLLIN | EPOLLRDHUP;
+        event.data.u64    = tag_of(slot, generation);
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+
+        if (spectator) {
+            // The kernel would grow the buffer to megabytes of stale frames for a viewer that stopped reading
+            setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &SERVER_VIEWER_SEND, sizeof(SERVER_VIEWER_SEND));
+
+            connection.spectator = std::make_unique<Spectator>();
+            viewers.push_back(slot);
+            spectators.fetch_add(1, std::memory_order_relaxed);
+
+            // The greeting, then the screen of the featured game
+            if (featured == nullptr) { feature(); }
+            else {
+                connection.spectator->watch(*featured->broadcast);
+                if (is_measuring()) { ++stats.keyframes; }
+            }
+            flush(connection);
+            continue;
+        }
+
+        connection.session = std::make_unique<Session>(seeds());
+        sessions.fetch_add(1, std::memory_order_relaxed);
+
+        // The first tick comes a whole period after connecting
+        deadlines.push(Deadline{now + tick_period, slot, generation});
+
+        // The greeting, then the first frame once the socket took it
+        render(connection);
+        if (featured == nullptr && !viewers.empty()) { feature(); }
+    }
+}
+
+void EventLoop::handle_socket(Connection &connection, const std::uint32_t events) {
+    const auto slot = connection.slot;
+
+    if (events & EPOLLIN) {
+        char buffer[SERVER_READ_BYTES];
+        for (;;) {
+            const auto count = recv(connection.fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (count > 0) {
+                if (is_measuring()) { stats.bytes_in += static_cast<unsigned long>(count); }
+                const auto bytes = std::string_view(buffer, static_cast<std::size_t>(count));
+                if (connection.session) { connection.session->receive(bytes); }
+                else { connection.spectator->receive(bytes); }
+                if (count < static_cast<ssize_t>(sizeof(buffer))) { break; }
+                continue;
+            }
+            if (count < 0 && (errno == EAGAIN || errno == EINTR)) { break; }
+
+            // End of stream or a reset
+            close_connection(slot, count < 0);
+            return;
+        }
+    } else if (events & (EPOLLERR | EPOLLHUP)) {
+        close_connection(slot, true);
+        return;
+    }
+
+    if (connection.spectator) {
+        flush(connection);
+        const auto &spectator = *connection.spectator;
+        if (spectator.is_closed() && (!spectator.has_output() || (events & EPOLLRDHUP))) { close_connection(slot, false); }
+        return;
+    }
+
+    // Keys read in one go are drawn as one frame
+    render(connection);
+
+    const auto &session = *connection.session;
+    if (session.is_overflowing()) { close_connection(slot, true); }
+    else if (session.is_closed() && (session.get_output().empty() || (events & EPOLLRDHUP))) { close_connection(slot, false); }
+}
+
+void EventLoop::run_ticks() {
+    while (!deadlines.empty()) {
+        const auto now      = ServerClock::now();
+        const auto deadline = deadlines.top();
+        if (deadline.time > now) { break; }
+        deadlines.pop();
+
+        auto *connection = find(deadline.slot, deadline.generation);
+        if (connection == nullptr) { continue; }
+
+        // Each tick is measured when it runs, so the cost of the ticks before it in the batch counts as lateness
+        const bool counted = is_measuring();
+        if (counted) {
+            ++stats.ticks;
+            stats.jitter.record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - deadline.time).count()));
+        }
+
+        auto &session = *connection->session;
+        session.tick();
+        if (session.is_dirty()) { render(*connection); }
+
+        // Keep the schedule, unless a whole period was missed: then skip ahead rather than tick in a burst
+        auto next = deadline.time + tick_period;
+        if (next <= now) {
+            next = now + tick_period;
+            if (counted) { ++stats.late; }
+        }
+        deadlines.push(Deadline{next, deadline.slot, deadline.generation});
+
+        if (session.is_overflowing()) { close_connection(deadline.slot, true); }
+    }
+}
+
+void EventLoop::arm_timer() {
+    if (deadlines.empty() || deadlines.top().time == armed) { return; }
+    armed = deadlines.top().time;
+
+    // The steady clock is CLOCK_MONOTONIC, so its time points are absolute timer values
+    const auto nanos      = std::chrono::duration_cast<std::chrono::nanoseconds>(armed.time_since_epoch()).count();
+    itimerspec spec       = {};
+    spec.it_value.tv_sec  = nanos / 1'000'000'000;
+    spec.it_value.tv_nsec = nanos % 1'000'000'000;
+    if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) { spec.it_value.tv_nsec = 1; } // Zero would disarm
+    timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+}
+
+void EventLoop::render(Connection &connection) {
+    auto      &session  = *connection.session;
+    const auto changed  = session.is_dirty();
+    const auto frames   = session.get_frames();
+    const auto deferred = session.get_deferred_frames();
+
+    // Send first: a frame is only drawn once the client took the previous one
+    flush(connection);
+    session.render();
+    flush(connection);
+
+    if (is_measuring()) {
+        stats.frames += session.get_frames() - frames;
+        stats.deferred += session.get_deferred_frames() - deferred;
+    }
+
+    // The spectators get every change, whether the player took the frame or not
+    if (changed && connection.broadcast) { publish(connection); }
+}
+
+void EventLoop::publish(Connection &connection) {
+    const auto frame = connection.broadcast->publish(connection.session->get_game());
+    if (!frame) { return; }
+    if (is_measuring()) { ++stats.published; }
+
+    // A spectator closed here takes the last one's place in the list, which is then looked at next
+    for (std::size_t i = 0; i < viewers.size();) {
+        auto      &viewer    = *connections[viewers[i]];
+        auto      &spectator = *viewer.spectator;
+        const auto keyframes = spectator.get_keyframes();
+        if (!spectator.offer(frame)) {
+            close_connection(viewer.slot, true);
+            continue;
+        }
+        if (is_measuring()) {
+            ++stats.offered;
+            stats.keyframes += spectator.get_keyframes() - keyframes;
+        }
+
+        flush(viewer);
+        ++i;
+    }
+}
+
+void EventLoop::feature() {
+    featured = nullptr;
+    if (viewers.empty() || !running.load(std::memory_order_relaxed)) { return; }
+
+    // The oldest player has the lowest generation
+    for (const auto &connection : connections) {
+        if (connection && connection->session && (featured == nullptr || connection->generation < featured->generation)) { featured = connection.get(); }
+    }
+    if (featured == nullptr) {
+        for (const auto slot : viewers) { connections[slot]->spectator->leave(); }
+        return;
+    }
+
+    // Every spectator starts over from a keyframe of the new game
+    featured->broadcast = std::make_unique<Broadcast>();
+    featured->broadcast->publish(featured->session->get_game());
+    for (const auto slot : viewers) {
+        auto &viewer = *connections[slot];
+        viewer.spectator->watch(*featured->broadcast);
+        if (is_measuring()) { ++stats.keyframes; }
+        flush(viewer);
+    }
+}
+
+void EventLoop::flush(Connection &connection) {
+    if (connection.session) {
+        auto &session = *connection.session;
+        while (!session.get_output().empty()) {
+            const auto output = session.get_output();
+            const auto count  = send(connection.fd, output.data(), output.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (is_measuring()) { ++stats.sends; }
+            if (count > 0) {
+                if (is_measuring()) { stats.bytes_out += static_cast<unsigned long>(count); }
+                session.consume(static_cast<std::size_t>(count));
+                continue;
+            }
+            if (count < 0 && errno == EINTR) { continue; }
+            // The socket is full, or broken: either way the output waits, an error shows up as an event
+            break;
+        }
+    } else {
+        // The frames go out straight from their shared buffers, as many as fit in one call
+        auto &spectator = *connection.spectator;
+        while (spectator.has_output()) {
+            iovec  vectors[SPECTATOR_IOVECS];
+            msghdr message     = {};
+            message.msg_iov    = vectors;
+            message.msg_iovlen = static_cast<std::size_t>(spectator.gather(vectors, SPECTATOR_IOVECS));
+
+            const auto count = sendmsg(connection.fd, &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (is_measuring()) { ++stats.sends; }
+            if (count > 0) {
+                if (is_measuring()) {
+                    stats.bytes_out += static_cast<unsigned long>(count);
+                    stats.watched += static_cast<unsigned long>(count);
+                }
+                spectator.consume(static_cast<std::size_t>(count));
+                continue;
+            }
+            if (count < 0 && errno == EINTR) { continue; }
+            break;
+        }
+    }
+
+    // Watch for room in the socket only while output waits, a writable socket would wake the loop all the time
+    const bool writing = connection.session ? !connection.session->get_output().empty() : connection.spectator->has_output();
+    if (writing == connection.writing) { return; }
+    connection.writing = writing;
+
+    epoll_event event = {};
+    event.events      = EPOLLIN | EPOLLRDHUP | (writing ? EPOLLOUT : 0u);
+    event.data.u64    = tag_of(connection.slot, connection.generation);
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection.fd, &event);
+}
+
+void EventLoop::close_connection(const std::uint32_t slot, const bool dropped) {
+    auto &connection = connections[slot];
+    if (dropped) {
+        // A reset rather than a close, which would keep sending the unread output from the kernel
+        const linger reset = {1, 0};
+        setsockopt(connection->fd, SOL_SOCKET, SO_LINGER, &reset, sizeof(reset));
+    }
+    ::close(connection->fd); // Also removes it from epoll
+    if (is_measuring()) { ++(dropped ? stats.dropped : stats.closed); }
+
+    const bool spectator  = connection->spectator != nullptr;
+    const bool unfeatured = connection.get() == featured;
+
+    // Its deadline stays in the heap, and is skipped once the generation no longer matches
+    connection.reset();
+    free_slots.push_back(slot);
+
+    if (spectator) {
+        *std::find(viewers.begin(), viewers.end(), slot) = viewers.back();
+        viewers.pop_back();
+        spectators.fetch_sub(1, std::memory_order_relaxed);
+
+        // Nobody watches anymore, the featured game stops encoding frames for nobody
+        if (viewers.empty() && featured != nullptr) {
+            featured->broadcast.reset();
+            featured = nullptr;
+        }
+        return;
+    }
+
+    sessions.fetch_sub(1, std::memory_order_relaxed);
+    if (unfeatured) { feature(); }
+}
+
+EventLoop::Connection *EventLoop::find(const std::uint32_t slot, const std::uint32_t generation) const {
+    if (slot >= connections.size() || !connections[slot] || connections[slot]->generation != generation) { return nullptr; }
+    return connections[slot].get();
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "broadcast.h"
+#include "histogram.h"
+#include "random.h"
+#include "session.h"
+
+using ServerClock = std::chrono::steady_clock; // CLOCK_MONOTONIC on Linux, the clock of the tick timers
+
+constexpr int SERVER_EPOLL_EVENTS = 256;   // Events taken from epoll per wakeup
+constexpr int SERVER_READ_BYTES   = 4096;  // Bytes read from a socket per call
+constexpr int SERVER_VIEWER_SEND  = 32768; // Send buffer of a spectator socket, small so frames wait where they can still be skipped
+
+// Counters of one event loop, counted while measuring and read once its thread stopped
+struct LoopStats {
+    unsigned long accepted  = 0; // Number of sockets adopted
+    unsigned long closed    = 0; // Number of sessions closed by their client
+    unsigned long dropped   = 0; // Number of sessions dropped for unread output or a socket error
+    unsigned long ticks     = 0; // Number of gravity ticks
+    unsigned long late      = 0; // Number of ticks skipped because the loop fell a whole period behind
+    unsigned long frames    = 0; // Number of frames queued
+    unsigned long deferred  = 0; // Number of frames deferred by unsent output
+    unsigned long bytes_in  = 0; // Bytes received
+    unsigned long bytes_out = 0; // Bytes sent
+    unsigned long sends     = 0; // Number of send calls
+    unsigned long wakeups   = 0; // Number of epoll_wait returns
+    unsigned long published = 0; // Number of frames broadcast to the spectators
+    unsigned long offered   = 0; // Number of broadcast frames offered to a spectator
+    unsigned long keyframes = 0; // Number of keyframes queued for a spectator, when it joins or falls behind
+    unsigned long watched   = 0; // Bytes sent to the spectators, also counted in the bytes sent
+    Histogram     jitter;        // Lateness of the gravity ticks (in microseconds)
+
+    void merge(const LoopStats &other);
+};
+
+// Event loop of one server thread: the sessions it owns, their sockets on one epoll instance, and their gravity ticks
+// in a deadline heap behind one timerfd armed for the earliest one. The acceptor hands sockets over through a queue
+// and an eventfd, after that a session is only ever touched by its loop. Spectators of the loop all watch its
+// featured game, that of its oldest player: each of its frames is encoded once and queued for every one of them.
+class EventLoop {
+public:
+    explicit EventLoop(std::uint64_t seed);
+    ~EventLoop();
+
+    EventLoop(const EventLoop &)            = delete;
+    EventLoop &operator=(const EventLoop &) = delete;
+
+    void start(); // Run the loop on its own thread
+    void stop();  // Ask the loop to stop, close its sessions and wait for its thread
+
+    void adopt(int fd, bool spectator = false);                                  // Hand a connected socket over to the loop, from any thread
+    void measure(bool enabled);                                                  // Start or stop counting, from any thread
+    void set_tick_period(ServerClock::duration period) { tick_period = period; } // Set the gravity period, before start
+
+    [[nodiscard]] unsigned int     get_sessions() const { return sessions.load(std::memory_order_relaxed); }     // Get the number of open sessions
+    [[nodiscard]] unsigned int     get_spectators() const { return spectators.load(std::memory_order_relaxed); } // Get the number of open spectators
+    [[nodiscard]] const LoopStats &get_stats() const { return stats; }                                          // Get the counters, once stopped
+
+private:
+    // A client socket and its session, or its spectator, at a slot reused once it closes
+    struct Connection {
+        int                        fd;              // Client socket
+        std::uint32_t              slot;            // Slot of the connection
+        std::uint32_t              generation;      // Generation of the slot, tells a reused slot from the closed connection
+        bool                       writing = false; // Flag set while waiting for the socket to take more output
+        std::unique_ptr<Session>   session;         // Game and streams of a player, null for a spectator
+        std::unique_ptr<Spectator> spectator;       // Frames queued for a spectator, null for a player
+        std::unique_ptr<Broadcast> broadcast;       // Frames of the game for the spectators, null unless featured
+
+        Connection(const int fd, const std::uint32_t slot, const std::uint32_t generation) : fd(fd), slot(slot), generation(generation) {}
+    };
+
+    // A socket handed over by the acceptor
+    struct Adopted {
+        int  fd;        // Client socket
+        bool spectator; // Flag set for a spectator, the socket of a player otherwise
+    };
+
+    // Next gravity tick of a session
+    struct Deadline {
+        ServerClock::time_point time;       // When the tick is due
+        std::uint32_t           slot;       // Slot of the session
+        std::uint32_t           generation; // Generation of the session in its slot
+
+        bool operator>(const Deadline &other) const { return time > other.time; }
+    };
+
+    int epoll_fd = -1; // Readiness of the sockets, the timer and the wakeup
+    int timer_fd = -1; // Timer armed for the earliest tick
+    int wake_fd  = -1; // Counter the acceptor and stop write to
+
+    std::thread           thread;                                 // Thread running the loop
+    std::atomic<bool>     running     = false;                    // Flag cleared to stop the loop
+    std::atomic<bool>     measuring   = false;                    // Flag set while counters are kept
+    std::mutex            adopt_mutex;                            // Guard of the adopted sockets
+    std::vector<Adopted>  adopted     = {};                       // Sockets handed over and not registered yet
+    ServerClock::duration tick_period = std::chrono::seconds(1); // Interval between the gravity ticks of a session
+
+    std::vector<std::unique_ptr<Connection>> connections = {};      // Connections by slot, empty slots are null
+    std::vector<std::uint32_t>               free_slots  = {};      // Slots free for the next connections
+    std::uint32_t                            generations = 0;       // Generation given to the next connection
+    std::atomic<unsigned int>                sessions    = 0;       // Number of open sessions
+    std::atomic<unsigned int>                spectators  = 0;       // Number of open spectators
+    std::vector<std::uint32_t>               viewers     = {};      // Slots of the spectators
+    Connection                              *featured    = nullptr; // Player whose game the spectators watch, null if none
+
+    std::priority_queue<Deadline, std::vector<Deadline>, std::greater<>> deadlines = {}; // Next tick of every session
+    ServerClock::time_point                                              armed     = {}; // Time the timer is armed for, zero if disarmed
+
+    Xoshiro256 seeds; // Seeds of the sessions
+    LoopStats  stats; // Counters of the loop
+
+    void run();                                                       // Wait for events until stopped
+    void register_adopted();                                          // Register the sockets handed over since the last wakeup
+    void handle_socket(Connection &connection, std::uint32_t events); // Read, send and render for one socket event
+    void run_ticks();                                                 // Tick every session whose deadline passed
+    void arm_timer();                                                 // Arm the timer for the earliest deadline
+    void render(Connection &connection);                              // Queue a frame if the session changed, and send it
+    void publish(Connection &connection);                             // Queue the frame of the featured game for the spectators, and send it
+    void feature();                                                   // Feature the oldest player, if any, while spectators watch
+    void flush(Connection &connection);                               // Send queued output until done or the socket is full
+    void close_connection(std::uint32_t slot, bool dropped);          // Close a connection and free its slot
+
+    [[nodiscard]] Connection *find(std::uint32_t slot, std::uint32_t generation) const; // Get a connection still open, null otherwise
+    [[nodiscard]] bool        is_measuring() const { return measuring.load(std::memory_order_relaxed); }
+};
@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+#include "histogram.h"
+#include "options.h"
+#include "random.h"
+#include "telnet.h"
+
+using LoadClock = std::chrono::steady_clock;
+
+constexpr std::string_view LOAD_KEYS[] = {"\x1b[D", "\x1b[C", "\x1b[D", "\x1b[C", "\x1b[B", "\x1b[A", " ", "w"}; // Keys a client sends, moves most often
+
+// Options of a load run
+struct LoadOptions {
+    int           tcp_port     = -1;          // TCP port to connect to, -1 for none
+    std::string   host         = "127.0.0.1"; // TCP host to connect to
+    std::string   unix_path    = {};          // Unix socket path to connect to, empty for none
+    unsigned int  clients      = 1000;        // Number of clients
+    double        duration     = 10;          // Seconds to run for
+    double        key_rate     = 2;           // Keys per second of every client, on average
+    unsigned int  connect_rate = 5000;        // Connections opened per second
+    bool          naws         = false;       // Send a telnet window size after connecting
+    bool          watch        = false;       // Connect as spectators, which only read
+    unsigned int  stalled      = 0;           // Number of clients that never read, with a small receive buffer
+    std::uint64_t seed         = 1;           // Seed of the key timings
+};
+
+// A simulated player
+struct LoadClient {
+    int                   fd       = -1; // Socket, -1 once closed
+    LoadClock::time_point key_sent = {}; // Time of the oldest key without output since, zero if none
+};
+
+// Next key of a client
+struct KeyDeadline {
+    LoadClock::time_point time;   // When the key is due
+    std::uint32_t         client; // Index of the client
+
+    bool operator>(const KeyDeadline &other) const { return time > other.time; }
+};
+
+// Counters of a load run
+struct LoadStats {
+    unsigned long connected = 0; // Number of clients connected
+    unsigned long failed    = 0; // Number of failed connections
+    unsigned long closed    = 0; // Number of clients closed by the server
+    unsigned long dropped   = 0; // Number of stalled clients closed by the server
+    unsigned long keys      = 0; // Number of keys sent
+    unsigned long bytes     = 0; // Bytes received
+    Histogram     response;      // Time from a key to the next output (in microseconds)
+};
+
+// A receive buffer that fills after a few frames, set before connecting so the window starts small
+static void stall(const int fd) {
+    const int bytes = 4096;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bytes, sizeof(bytes));
+}
+
+static int connect_client(const LoadOptions &options, const bool stalled) {
+    if (!options.unix_path.empty()) {
+        const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (stalled) { stall(fd); }
+
+        sockaddr_un address = {};
+        address.sun_family  = AF_UNIX;
+        std::strncpy(address.sun_path, options.unix_path.c_str(), sizeof(address.sun_path) - 1);
+        if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0) { return fd; }
+        close(fd);
+        return -1;
+    }
+
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (stalled) { stall(fd); }
+
+    sockaddr_in address = {};
+    address.sin_family  = AF_INET;
+    address.sin_port    = htons(static_cast<std::uint16_t>(options.tcp_port));
+    inet_pton(AF_INET, options.host.c_str(), &address.sin_addr);
+    if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0 || errno == EINPROGRESS) { return fd; }
+    close(fd);
+    return -1;
+}
+
+// Time until a client sends its next key: exponential gaps, so keys from all clients arrive as a Poisson stream
+static LoadClock::duration next_key_gap(Xoshiro256 &rng, const double rate) {
+    const auto uniform = (static_cast<double>(rng() >> 11) + 0.5) / static_cast<double>(1ull << 53);
+    return std::chrono::duration_cast<LoadClock::duration>(std::chrono::duration<double>(-std::log(uniform) / rate));
+}
+
+static void print_stats(const LoadStats &stats, const double seconds) {
+    std::printf("%lu clients connected (%lu attempts refused and retried, %lu closed by the server), ran for %.1f s\n", stats.connected, stats.failed, stats.closed, seconds);
+    if (stats.dropped > 0) { std::printf("  %lu stalled clients dropped by the server\n", stats.dropped); }
+    std::printf("  keys %lu (%.0f/s), received %.1f KB/s\n", stats.keys, static_cast<double>(stats.keys) / seconds,
+                static_cast<double>(stats.bytes) / seconds / 1024);
+    if (stats.keys == 0) { return; }
+    std::printf("  key to output (us) mean %.1f  p50 %llu  p90 %llu  p99 %llu  max %llu\n", stats.response.get_mean(),
+                static_cast<unsigned long long>(stats.response.percentile(50)), static_cast<unsigned long long>(stats.response.percentile(90)),
+                static_cast<unsigned long long>(stats.response.percentile(99)), static_cast<unsigned long long>(stats.response.get_max()));
+}
+
+int main(const int argc, char **argv) {
+    LoadOptions options;
+    for (int i = 1; i < argc; ++i) {
+        bool valid = true;
+        if (std::strcmp(argv[i], "--tcp") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.tcp_port); }
+        else if (std::strcmp(argv[i], "--host") == 0 && i + 1 < argc) { options.host = argv[++i]; }
+        else if (std::strcmp(argv[i], "--unix") == 0 && i + 1 < argc) { options.unix_path = argv[++i]; }
+        else if (std::strcmp(argv[i], "--clients") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.clients); }
+        else if (std::strcmp(argv[i], "--duration") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.duration); }
+        else if (std::strcmp(argv[i], "--key-rate") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.key_rate); }
+        else if (std::strcmp(argv[i], "--connect-rate") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.connect_rate); }
+        else if (std::strcmp(argv[i], "--naws") == 0) { options.naws = true; }
+        else if (std::strcmp(argv[i], "--watch") == 0) { options.watch = true; }
+        else if (std::strcmp(argv[i], "--stalled") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.stalled); }
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.seed); }
+        else { valid = false; }
+
+        if (!valid) {
+            std::fprintf(stderr, "usage: %s (--tcp PORT [--host ADDRESS] | --unix PATH) [--clients N] [--duration S] [--key-rate R] [--connect-rate R] [--naws] [--watch] [--stalled N] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    options.connect_rate = std::max(1u, options.connect_rate);
+    if (options.tcp_port < 0 && options.unix_path.empty()) { options.tcp_port = 2323; }
+
+    const int               epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    std::vector<LoadClient> clients(options.clients);
+    Xoshiro256              rng(options.seed);
+    LoadStats               stats;
+
+    std::priority_queue<KeyDeadline, std::vector<KeyDeadline>, std::greater<>> keys;
+
+    // A window of 80x24, as a telnet client sends it once the server asked
+    constexpr unsigned char naws[] = {TELNET_IAC, TELNET_WILL, TELNET_OPTION_NAWS, TELNET_IAC, TELNET_SB, TELNET_OPTION_NAWS, 0, 80, 0, 24, TELNET_IAC, TELNET_SE};
+
+    const auto   started = LoadClock::now();
+    const auto   stop_at = started + std::chrono::duration_cast<LoadClock::duration>(std::chrono::duration<double>(options.duration));
+    unsigned int opened  = 0;
+    static char  buffer[1 << 16];
+    for (auto now = started; now < stop_at; now = LoadClock::now()) {
+        // Open connections at the connect rate, retrying those the server had no room for yet
+        const auto due = std::min<unsigned long>(options.clients, static_cast<unsigned long>(std::chrono::duration<double>(now - started).count() * options.connect_rate) + 1);
+        while (opened < due) {
+            const bool stalled = opened < options.stalled;
+            const int  fd      = connect_client(options, stalled);
+            if (fd < 0) {
+                ++stats.failed;
+                break;
+            }
+
+            auto &client = clients[opened];
+            client.fd    = fd;
+            if (options.naws) { (void) send(fd, naws, sizeof(naws), MSG_NOSIGNAL); }
+
+            // A stalled client only hears about the server closing it
+            epoll_event event = {};
+            event.events      = stalled ? EPOLLRDHUP : EPOLLIN | EPOLLRDHUP;
+            event.data.u32    = opened;
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+
+            if (!options.watch && !stalled) { keys.push(KeyDeadline{now + next_key_gap(rng, options.key_rate), opened}); }
+            ++stats.connected;
+            ++opened;
+        }
+
+        auto wake = stop_at;
+        if (!keys.empty()) { wake = std::min(wake, keys.top().time); }
+        if (opened < options.clients) { wake = std::min(wake, now + std::chrono::milliseconds(1)); }
+        const auto timeout = static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(wake - now).count());
+
+        epoll_event events[256];
+        const int   count = epoll_wait(epoll_fd, events, 256, std::max(timeout, 0));
+        now               = LoadClock::now();
+        for (int i = 0; i < count; ++i) {
+            const auto index  = events[i].data.u32;
+            auto      &client = clients[index];
+            if (client.fd < 0) { continue; }
+            if (index < options.stalled) {
+                close(client.fd);
+                client.fd = -1;
+                ++stats.dropped;
+                continue;
+            }
+
+            ssize_t received;
+            while ((received = recv(client.fd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+                stats.bytes += static_cast<unsigned long>(received);
+                if (client.key_sent != LoadClock::time_point()) {
+                    stats.response.record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - client.key_sent).count()));
+                    client.key_sent = {};
+                }
+            }
+            if (received == 0 || (received < 0 && errno != EAGAIN && errno != EINTR)) {
+                close(client.fd);
+                client.fd = -1;
+                ++stats.closed;
+            }
+        }
+
+        // Send the keys that are due
+        while (!keys.empty() && keys.top().time <= now) {
+            const auto deadline = keys.top();
+            keys.pop();
+
+            auto &client = clients[deadline.client];
+            if (client.fd < 0) { continue; }
+
+            const auto key = LOAD_KEYS[rng() % std::size(LOAD_KEYS)];
+            if (send(client.fd, key.data(), key.size(), MSG_NOSIGNAL | MSG_DONTWAIT) == static_cast<ssize_t>(key.size())) {
+                ++stats.keys;
+                if (client.key_sent == LoadClock::time_point()) { client.key_sent = now; }
+            }
+            keys.push(KeyDeadline{deadline.time + next_key_gap(rng, options.key_rate), deadline.client});
+        }
+    }
+
+    print_stats(stats, std::chrono::duration<double>(LoadClock::now() - started).count());
+
+    for (const auto &client : clients) {
+        if (client.fd >= 0) { close(client.fd); }
+    }
+    close(epoll_fd);
+}
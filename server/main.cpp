@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "event-loop.h"
+#include "options.h"
+
+#include "configs/constants.h"
+
+// Options of a server run
+struct ServerOptions {
+    int           tcp_port      = -1;                                                // TCP port to listen on, -1 for none
+    std::string   unix_path     = {};                                                // Unix socket path to listen on, empty for none
+    int           spectate_port = -1;                                                // TCP port spectators connect to, -1 for none
+    std::string   spectate_path = {};                                                // Unix socket path spectators connect to, empty for none
+    unsigned int  loops         = std::max(1u, std::thread::hardware_concurrency()); // Number of event loops
+    double        duration      = 0;                                                 // Seconds to run for, 0 until interrupted
+    double        warmup        = 0;                                                 // Seconds before counting starts
+    std::uint64_t seed          = 1;                                                 // Seed of the session seeds
+};
+
+// Processor time used by the process (in seconds)
+static double cpu_seconds() {
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+static int listen_tcp(const int port) {
+    const int fd  = socket(AF_INET6, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    const int on  = 1;
+    const int off = 0;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &off, sizeof(off));
+
+    sockaddr_in6 address = {};
+    address.sin6_family  = AF_INET6;
+    address.sin6_addr    = in6addr_any;
+    address.sin6_port    = htons(static_cast<std::uint16_t>(port));
+    if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        std::perror("tcp listen");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int listen_unix(const std::string &path) {
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+    sockaddr_un address = {};
+    address.sun_family  = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    unlink(path.c_str()); // A socket left by an earlier run
+    if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        std::perror("unix listen");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void print_stats(const ServerOptions &options, const LoopStats &stats, const unsigned int sessions, const unsigned int spectators, const double seconds,
+                        const double cpu) {
+    const auto cores = seconds > 0 ? cpu / seconds : 0.0;
+
+    std::printf("%u sessions and %u spectators on %u loops, measured for %.1f s\n", sessions, spectators, options.loops, seconds);
+    std::printf("  ticks %lu (%.0f/s, %lu late), frames %lu (%.0f/s, %lu deferred)\n", stats.ticks, static_cast<double>(stats.ticks) / seconds,
+                stats.late, stats.frames, static_cast<double>(stats.frames) / seconds, stats.deferred);
+    std::printf("  in %.1f KB/s, out %.1f KB/s in %lu sends, %lu wakeups, %lu accepted, %lu closed, %lu dropped\n",
+                static_cast<double>(stats.bytes_in) / seconds / 1024, static_cast<double>(stats.bytes_out) / seconds / 1024, stats.sends, stats.wakeups,
+                stats.accepted, stats.closed, stats.dropped);
+    if (spectators > 0 || stats.published > 0) {
+        std::printf("  broadcast %lu frames (%.0f/s), %lu offered to spectators, %lu keyframes, %.1f KB/s to spectators\n", stats.published,
+                    static_cast<double>(stats.published) / seconds, stats.offered, stats.keyframes, static_cast<double>(stats.watched) / seconds / 1024);
+    }
+    std::printf("  cpu %.3f cores, %.0f sessions/core\n", cores, cores > 0 ? sessions / cores : 0.0);
+    std::printf("  tick jitter (us) mean %.1f  p50 %llu  p90 %llu  p99 %llu  p99.9 %llu  max %llu\n", stats.jitter.get_mean(),
+                static_cast<unsigned long long>(stats.jitter.percentile(50)), static_cast<unsigned long long>(stats.jitter.percentile(90)),
+                static_cast<unsigned long long>(stats.jitter.percentile(99)), static_cast<unsigned long long>(stats.jitter.percentile(99.9)),
+                static_cast<unsigned long long>(stats.jitter.get_max()));
+}
+
+int main(const int argc, char **argv) {
+    ServerOptions options;
+    for (int i = 1; i < argc; ++i) {
+        bool valid = true;
+        if (std::strcmp(argv[i], "--tcp") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.tcp_port); }
+        else if (std::strcmp(argv[i], "--unix") == 0 && i + 1 < argc) { options.unix_path = argv[++i]; }
+        else if (std::strcmp(argv[i], "--spectate-tcp") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.spectate_port); }
+        else if (std::strcmp(argv[i], "--spectate-unix") == 0 && i + 1 < argc) { options.spectate_path = argv[++i]; }
+        else if (std::strcmp(argv[i], "--loops") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.loops); }
+        else if (std::strcmp(argv[i], "--duration") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.duration); }
+        else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.warmup); }
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], options.seed); }
+        else { valid = false; }
+
+        if (!valid) {
+            std::fprintf(stderr, "usage: %s [--tcp PORT] [--unix PATH] [--spectate-tcp PORT] [--spectate-unix PATH] [--loops N] [--duration S] [--warmup S] [--seed N]\n", argv[0]);
+            return 2;
+        }
+    }
+    options.loops = std::max(1u, options.loops);
+    if (options.tcp_port < 0 && options.unix_path.empty()) { options.tcp_port = 2323; }
+
+    // Signals are taken by the acceptor from a signalfd, so every thread started from here blocks them
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    const int signal_fd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+
+    // Players go to the loops in turn, spectators all to the first loop, to watch the game it features
+    std::vector<int> listeners;
+    std::vector<int> spectate;
+    if (options.tcp_port >= 0) { listeners.push_back(listen_tcp(options.tcp_port)); }
+    if (!options.unix_path.empty()) { listeners.push_back(listen_unix(options.unix_path)); }
+    if (options.spectate_port >= 0) { spectate.push_back(listen_tcp(options.spectate_port)); }
+    if (!options.spectate_path.empty()) { spectate.push_back(listen_unix(options.spectate_path)); }
+    for (const auto fd : spectate) { listeners.push_back(fd); }
+    for (const auto fd : listeners) {
+        if (fd < 0) { return 1; }
+    }
+
+    Xoshiro256                              seeds(options.seed);
+    std::vector<std::unique_ptr<EventLoop>> loops;
+    for (unsigned int i = 0; i < options.loops; ++i) {
+        loops.push_back(std::make_unique<EventLoop>(seeds()));
+        loops.back()->set_tick_period(std::chrono::milliseconds(1000 / GAME_TICK_RATE));
+        loops.back()->start();
+    }
+
+    const int   epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event    = {};
+    event.events         = EPOLLIN;
+    for (const auto fd : listeners) {
+        event.data.fd = fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+    }
+    event.data.fd = signal_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, signal_fd, &event);
+
+    std::printf("listening:");
+    if (options.tcp_port >= 0) { std::printf(" tcp %d", options.tcp_port); }
+    if (!options.unix_path.empty()) { std::printf(" unix %s", options.unix_path.c_str()); }
+    if (options.spectate_port >= 0) { std::printf(", spectators tcp %d", options.spectate_port); }
+    if (!options.spectate_path.empty()) { std::printf(", spectators unix %s", options.spectate_path.c_str()); }
+    std::printf(", %u loops\n", options.loops);
+    std::fflush(stdout);
+
+    // The acceptor
+    const auto  started     = ServerClock::now();
+    const auto  measure_at  = started + std::chrono::duration_cast<ServerClock::duration>(std::chrono::duration<double>(options.warmup));
+    const auto  stop_at     = started + std::chrono::duration_cast<ServerClock::duration>(std::chrono::duration<double>(options.duration));
+    bool        measuring   = false;
+    auto        measured    = started;
+    double      cpu_started = 0;
+    std::size_t next        = 0;
+    for (bool running = true; running;) {
+        const auto now = ServerClock::now();
+        if (!measuring && now >= measure_at) {
+            measuring   = true;
+            measured    = now;
+            cpu_started = cpu_seconds();
+            for (const auto &loop : loops) { loop->measure(true); }
+        }
+        if (options.duration > 0 && now >= stop_at) { break; }
+
+        auto wake = options.duration > 0 ? stop_at : ServerClock::time_point::max();
+        if (!measuring) { wake = std::min(wake, measure_at); }
+        const auto timeout = wake == ServerClock::time_point::max()
+                                 ? -1
+                                 : static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(wake - now).count());
+
+        epoll_event events[8];
+        const int   count = epoll_wait(epoll_fd, events, 8, timeout);
+        for (int i = 0; i < count; ++i) {
+            if (events[i].data.fd == signal_fd) {
+                running = false;
+                continue;
+            }
+            for (;;) {
+                const int fd = accept4(events[i].data.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (fd < 0) {
+                    // Out of descriptors: give the loops a moment to close some rather than spin on the listener
+                    if (errno == EMFILE || errno == ENFILE) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+                    break;
+                }
+                const int on = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on)); // Fails harmlessly on a unix socket
+                if (std::find(spectate.begin(), spectate.end(), events[i].data.fd) != spectate.end()) { loops.front()->adopt(fd, true); }
+                else { loops[next++ % loops.size()]->adopt(fd); }
+            }
+        }
+    }
+
+    const auto   seconds    = std::chrono::duration<double>(ServerClock::now() - measured).count();
+    const auto   cpu        = cpu_seconds() - cpu_started;
+    unsigned int sessions   = 0;
+    unsigned int spectators = 0;
+    for (const auto &loop : loops) {
+        loop->measure(false);
+        sessions += loop->get_sessions();
+        spectators += loop->get_spectators();
+    }
+
+    LoopStats stats;
+    for (const auto &loop : loops) {
+        loop->stop();
+        stats.merge(loop->get_stats());
+    }
+    if (measuring) { print_stats(options, stats, sessions, spectators, seconds, cpu); }
+
+    for (const auto fd : listeners) { close(fd); }
+    if (!options.unix_path.empty()) { unlink(options.unix_path.c_str()); }
+    if (!options.spectate_path.empty()) { unlink(options.spectate_path.c_str()); }
+    close(epoll_fd);
+    close(signal_fd);
+}
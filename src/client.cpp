@@ -0,0 +1,186 @@
+#include "client.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "metrics.h"
+#include "random.h"
+#include "curses-renderer.h"
+
+#include "configs/input.h"
+
+void Client::init() { init(Random::entropy()); }
+void Client::init(const std::uint64_t seed) {
+    // Initialize components, drawing with ncurses unless another renderer was set
+    if (!renderer) { renderer = std::make_unique<CursesRenderer>(); }
+    renderer->init();
+    game.init(seed);
+}
+void Client::record(const std::string &path) { replay.open(path, game.get_seed()); }
+bool Client::terminate() {
+    // Clean up resources
+    const bool recorded = replay.finish(game);
+    renderer->terminate();
+    return recorded;
+}
+
+
+void Client::loop() {
+    using clock = std::chrono::steady_clock;
+
+    constexpr auto tick_period = std::chrono::milliseconds(1000 / GAME_TICK_RATE);
+    constexpr auto move_period = std::chrono::milliseconds(BOT_MOVE_MS);
+
+    // With nothing drawn no one watches the pace, so time jumps from deadline to deadline instead of waiting for them
+    const bool simulated = !renderer->is_drawn();
+
+    started        = clock::now();
+    auto next_tick = started + tick_period;
+    auto next_move = started + move_period;
+
+    game.tick();
+    redraw();
+
+    while (running && !game.is_over() && (max_pieces == 0 || game.get_pieces_placed() < max_pieces)) {
+        // Sleep until a key arrives, the next tick is due or a held key repeats
+        auto deadline = autoplay ? std::min(next_tick, next_move) : next_tick;
+        for (const auto *repeat : {&repeat_left, &repeat_right, &repeat_down}) {
+            if (const auto repeat_deadline = repeat->next_deadline()) { deadline = std::min(deadline, *repeat_deadline); }
+        }
+        renderer->wait_input(simulated ? std::chrono::milliseconds(0) : std::chrono::ceil<std::chrono::milliseconds>(deadline - clock::now()));
+        ++wakeups;
+
+        // Apply every pending key as one batch
+        const auto now = simulated ? deadline : clock::now();
+        {
+            PhaseTimer timer(Phase::Input);
+            while (handle_input(now)) {}
+            handle_repeats(now);
+        }
+
+        if (autoplay && now >= next_move) {
+            PhaseTimer timer(Phase::Bot);
+            next_move = now + move_period;
+            bot.find_move(game).for_each_action([this](const Action action) { apply(action, 1); });
+        }
+
+        if (now >= next_tick) {
+            PhaseTimer timer(Phase::Tick);
+            next_tick = now + tick_period;
+            const auto before = game.snapshot();
+            if (game.tick()) {
+                force_redraw = true;
+                remember(before);
+            }
+        }
+
+        // Show any state change right away
+        if (force_redraw) { redraw(); }
+    }
+
+    stopped = clock::now();
+}
+
+void Client::redraw() {
+    force_redraw = false;
+
+    if (renderer->is_drawn()) {
+        PhaseTimer frame_timer(Phase::Frame);
+        {
+            PhaseTimer timer(Phase::Update);
+            renderer->update();
+        }
+        {
+            PhaseTimer timer(Phase::Draw);
+            scene.draw(*renderer, game);
+        }
+        PhaseTimer timer(Phase::Refresh);
+        renderer->refresh();
+    }
+
+    // Every key read so far is now visible
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto &read_time : pending_keys) {
+        input_latency.record(std::chrono::duration_cast<std::chrono::microseconds>(now - read_time).count());
+    }
+    pending_keys.clear();
+}
+
+double Client::get_wakeups_per_second() const {
+    const auto seconds = std::chrono::duration<double>(stopped - started).count();
+    return seconds > 0 ? static_cast<double>(wakeups) / seconds : 0.0;
+}
+
+bool Client::handle_input(const KeyRepeat::time_point now) {
+    const auto key = renderer->read_key();
+    if (key == KEY_CODE_NONE) { return false; }
+
+    pending_keys.push_back(now);
+    force_redraw = true; // Refresh even when the key changes nothing, so its latency is measured
+
+    switch (key) {
+        case INPUT_KEY_LEFT: // Move shape left
+            apply(Action::Left, repeat_left.press(now));
+            break;
+        case INPUT_KEY_RIGHT: // Move shape right
+            apply(Action::Right, repeat_right.press(now));
+            break;
+        case INPUT_KEY_DOWN: // Move shape down
+            apply(Action::SoftDrop, repeat_down.press(now));
+            break;
+        case INPUT_KEY_UP: // Rotate shape clockwise
+            apply(Action::Rotate, 1);
+            break;
+        case INPUT_KEY_PLACE: // Place shape immediately
+            apply(Action::HardDrop, 1);
+            break;
+        case INPUT_KEY_SWAP: // Swap shapes
+            apply(Action::Hold, 1);
+            break;
+        case INPUT_KEY_UNDO: // Undo the last placement
+            undo();
+            break;
+        case INPUT_KEY_METRICS: // Show or hide the metrics overlay
+            scene.show_metrics = !scene.show_metrics;
+            break;
+        case INPUT_KEY_QUIT: // Quit the game
+            running = false;
+            break;
+        case KEY_CODE_RESIZE: // Terminal resized
+            force_redraw = true;
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+void Client::handle_repeats(const KeyRepeat::time_point now) {
+    apply(Action::Left, repeat_left.update(now));
+    apply(Action::Right, repeat_right.update(now));
+    apply(Action::SoftDrop, repeat_down.update(now));
+}
+void Client::apply(const Action action, const int times) {
+    for (int i = 0; i < times; ++i) {
+        const auto before = game.snapshot();
+        if (!game.apply(action)) { continue; }
+
+        force_redraw = true;
+        replay.record(action, game.get_ticks());
+        remember(before);
+    }
+}
+void Client::remember(const GameState &before) {
+    // A recorded game must replay the exact actions, so nothing can be taken back
+    if (replay.is_open() || game.get_pieces_placed() == before.pieces_placed) { return; }
+    undo_ring.push(before);
+}
+void Client::undo() {
+    if (replay.is_open()) { return; }
+
+    GameState state;
+    if (undo_ring.pop(state)) {
+        game.restore(state);
+        force_redraw = true;
+    }
+}
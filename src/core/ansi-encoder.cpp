@@ -0,0 +1,145 @@
+#include "ansi-encoder.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "colors.h"
+#include "keys.h"
+
+constexpr std::string_view ANSI_SYNC_BEGIN = "\x1b[?2026h"; // Start of a synchronized update
+constexpr std::string_view ANSI_SYNC_END   = "\x1b[?2026l"; // End of a synchronized update
+
+void AnsiEncoder::resize(const Vec2 &size) {
+    buffer.resize(ANSI_FRAME_BYTES + static_cast<std::size_t>(size.x) * size.y * ANSI_CELL_BYTES);
+    reset();
+}
+void AnsiEncoder::reset() {
+    color  = -1;
+    cursor = Vec2(-1, -1);
+}
+
+void AnsiEncoder::begin_frame() {
+    length = 0;
+    if (synchronized) { append(ANSI_SYNC_BEGIN); }
+}
+void AnsiEncoder::clear_screen() {
+    // The reset leaves the colors of pair 0, those of blank cells
+    append("\x1b[0m\x1b[2J");
+    color = 0;
+}
+void AnsiEncoder::write_span(const int x, const int y, const Cell *cells, const int n) {
+    // Runs are contiguous, so only their start may need a cursor move
+    if (cursor != Vec2(x, y)) {
+        append("\x1b[");
+        append_number(y + 1);
+        append(";");
+        append_number(x + 1);
+        append("H");
+    }
+
+    for (int i = 0; i < n; ++i) {
+        set_color(cells[i].color);
+        append_glyph(cells[i].glyph);
+    }
+    cursor = Vec2(x + n, y);
+}
+std::string_view AnsiEncoder::end_frame() {
+    // An empty frame is not worth sending
+    if (length == (synchronized ? ANSI_SYNC_BEGIN.size() : 0)) {
+        length = 0;
+        return {};
+    }
+
+    if (synchronized) { append(ANSI_SYNC_END); }
+    return get_frame();
+}
+
+void AnsiEncoder::append(const std::string_view bytes) {
+    std::memcpy(buffer.data() + length, bytes.data(), bytes.size());
+    length += bytes.size();
+}
+void AnsiEncoder::append_number(int value) {
+    char digits[12];
+    int  count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count > 0) { buffer[length++] = digits[--count]; }
+}
+void AnsiEncoder::append_glyph(const wchar_t glyph) {
+    const auto code = static_cast<std::uint32_t>(glyph);
+    auto      *out  = buffer.data() + length;
+    if (code < 0x80) {
+        out[0] = static_cast<char>(code);
+        length += 1;
+    } else if (code < 0x800) {
+        out[0] = static_cast<char>(0xc0 | code >> 6);
+        out[1] = static_cast<char>(0x80 | (code & 0x3f));
+        length += 2;
+    } else if (code < 0x10000) {
+        out[0] = static_cast<char>(0xe0 | code >> 12);
+        out[1] = static_cast<char>(0x80 | (code >> 6 & 0x3f));
+        out[2] = static_cast<char>(0x80 | (code & 0x3f));
+        length += 3;
+    } else {
+        out[0] = static_cast<char>(0xf0 | code >> 18);
+        out[1] = static_cast<char>(0x80 | (code >> 12 & 0x3f));
+        out[2] = static_cast<char>(0x80 | (code >> 6 & 0x3f));
+        out[3] = static_cast<char>(0x80 | (code & 0x3f));
+        length += 4;
+    }
+}
+void AnsiEncoder::set_color(const short pair) {
+    if (pair == color) { return; }
+    color = pair;
+
+    const auto colors = pair >= 0 && pair < COLOR_PAIR_COUNT ? COLOR_PALETTE[pair] : ColorPair();
+    append("\x1b[0");
+    if (colors.foreground >= 0) {
+        append(";3");
+        append_number(colors.foreground);
+    }
+    if (colors.background >= 0) {
+        append(";4");
+        append_number(colors.background);
+    }
+    append("m");
+}
+
+int decode_ansi_key(const char *bytes, const int available, int &consumed, const bool complete) {
+    consumed = 0;
+    if (available <= 0) { return KEY_CODE_NONE; }
+
+    if (bytes[0] != '\x1b') {
+        consumed = 1;
+        return static_cast<unsigned char>(bytes[0]);
+    }
+
+    // Escape followed by nothing yet: the rest of a sequence may still be on its way
+    const bool introducer = available >= 2 && (bytes[1] == '[' || bytes[1] == 'O');
+    if (available < 3 && (available == 1 || introducer)) {
+        if (!complete) { return KEY_CODE_NONE; }
+        consumed = 1;
+        return KEY_CODE_ESCAPE;
+    }
+    if (!introducer) {
+        consumed = 1;
+        return KEY_CODE_ESCAPE;
+    }
+
+    switch (bytes[2]) {
+        case 'A': consumed = 3; return KEY_CODE_UP;
+        case 'B': consumed = 3; return KEY_CODE_DOWN;
+        case 'C': consumed = 3; return KEY_CODE_RIGHT;
+        case 'D': consumed = 3; return KEY_CODE_LEFT;
+        default: break;
+    }
+
+    // Skip any other sequence up to its final byte, reported as no key
+    int end = 2;
+    while (end < available && (bytes[end] < 0x40 || bytes[end] > 0x7e)) { ++end; }
+    if (end == available && !complete) { return KEY_CODE_NONE; }
+    consumed = end < available ? end + 1 : available;
+    return KEY_CODE_NONE;
+}
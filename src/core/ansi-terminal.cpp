@@ -0,0 +1,126 @@
+#include "ansi-terminal.h"
+
+#include <cerrno>
+#include <sys/ioctl.h>
+
+#include "keys.h"
+
+void AnsiTerminal::open() {
+    if (opened) { return; }
+    opened = true;
+
+    // Raw mode: keys arrive one by one, without echo, and reads never block
+    if (tcgetattr(input, &saved_mode) == 0) {
+        auto mode = saved_mode;
+        mode.c_lflag &= ~(ICANON | ECHO | IEXTEN);
+        mode.c_iflag &= ~(IXON | ICRNL);
+        mode.c_cc[VMIN]  = 0;
+        mode.c_cc[VTIME] = 0;
+        raw = tcsetattr(input, TCSAFLUSH, &mode) == 0;
+    }
+
+    // Without SA_RESTART a resize interrupts the wait for input, so it is handled right away
+    struct sigaction action = {};
+    action.sa_handler = on_resize;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGWINCH, &action, nullptr);
+
+    // ^C and the like still end the program, but not before the terminal is usable again. A signal that was
+    // ignored, as under nohup, stays ignored
+    exit_input  = raw ? input : -1;
+    exit_output = output;
+    exit_mode   = saved_mode;
+    action.sa_handler = on_exit_signal;
+    for (std::size_t i = 0; i < std::size(ANSI_EXIT_SIGNALS); ++i) {
+        sigaction(ANSI_EXIT_SIGNALS[i], &action, &exit_actions[i]);
+        if (exit_actions[i].sa_handler == SIG_IGN) { sigaction(ANSI_EXIT_SIGNALS[i], &exit_actions[i], nullptr); }
+    }
+
+    query_size();
+    write_all(ANSI_SCREEN_ENTER.data(), ANSI_SCREEN_ENTER.size());
+}
+void AnsiTerminal::close() {
+    if (!opened) { return; }
+    opened = false;
+
+    signal(SIGWINCH, SIG_DFL);
+    for (std::size_t i = 0; i < std::size(ANSI_EXIT_SIGNALS); ++i) { sigaction(ANSI_EXIT_SIGNALS[i], &exit_actions[i], nullptr); }
+    exit_input  = -1;
+    exit_output = -1;
+
+    write_all(ANSI_SCREEN_LEAVE.data(), ANSI_SCREEN_LEAVE.size());
+
+    if (raw) { tcsetattr(input, TCSAFLUSH, &saved_mode); }
+    raw = false;
+}
+
+void AnsiTerminal::resize(const Vec2 &new_size) {
+    size = new_size;
+    encoder.resize(size);
+}
+bool AnsiTerminal::update_size() {
+    const int signals = resize_signals;
+    if (signals == resizes_applied) { return false; }
+    resizes_applied = signals;
+    return query_size();
+}
+bool AnsiTerminal::query_size() {
+    winsize window = {};
+    if (ioctl(output, TIOCGWINSZ, &window) != 0 || window.ws_col == 0 || window.ws_row == 0) { return false; }
+
+    const Vec2 new_size(window.ws_col, window.ws_row);
+    if (new_size == size) { return false; }
+
+    resize(new_size);
+    return true;
+}
+
+bool AnsiTerminal::end_frame() {
+    // An empty frame is not worth a system call
+    const auto bytes = encoder.end_frame();
+    return bytes.empty() || write_all(bytes.data(), bytes.size());
+}
+
+int AnsiTerminal::read_key() {
+    if (is_resize_pending()) {
+        resizes_reported = resize_signals;
+        return KEY_CODE_RESIZE;
+    }
+
+    if (input_start == input_end) {
+        const auto count = read(input, input_buffer, sizeof(input_buffer));
+        if (count <= 0) { return KEY_CODE_NONE; }
+        input_start = 0;
+        input_end   = static_cast<int>(count);
+    }
+
+    // Keys are read one at a time, so a sequence cut by the end of a read is rare and taken as it is
+    int        consumed = 0;
+    const auto key = decode_ansi_key(input_buffer + input_start, input_end - input_start, consumed);
+    input_start += consumed;
+    return key == KEY_CODE_NONE ? read_key() : key;
+}
+
+bool AnsiTerminal::write_all(const char *bytes, std::size_t count) {
+    while (count > 0) {
+        ++writes;
+        const auto written = write(output, bytes, count);
+        if (written < 0) {
+            if (errno == EINTR || errno == EAGAIN) { continue; }
+            return false;
+        }
+        bytes += written;
+        count -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+void AnsiTerminal::on_resize(int) { resize_signals = resize_signals + 1; }
+void AnsiTerminal::on_exit_signal(const int signal) {
+    // Only async-signal-safe calls here. The signal is raised again with its default action, which ends the program
+    // once the handler returns
+    if (exit_output >= 0) { [[maybe_unused]] const auto written = write(exit_output, ANSI_SCREEN_LEAVE.data(), ANSI_SCREEN_LEAVE.size()); }
+    if (exit_input >= 0) { tcsetattr(exit_input, TCSAFLUSH, &exit_mode); }
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
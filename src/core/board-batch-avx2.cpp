@@ -0,0 +1,10 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt), only called after a runtime CPU check
+
+#define TETRIS_BATCH_AVX2
+#include "board-batch-kernel.h"
+
+#if TETRIS_AVX2_KERNEL && defined(__AVX2__)
+void compute_features_avx2(const BitRow (*rows)[BOARD_BATCH_SIZE], const int count, BoardBatchFeatures &features) {
+    compute_features<Avx2Ops>(rows, count, features);
+}
+#endif
@@ -0,0 +1,157 @@
+#pragma once
+
+// Feature kernel shared by every instruction set. Included by one translation unit per instruction set, everything
+// here has internal linkage so code compiled for AVX2 can never be picked by the linker for another translation unit.
+
+#include "board-batch.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define TETRIS_X86 1
+#include <immintrin.h>
+#else
+#define TETRIS_X86 0
+#endif
+
+namespace {
+    // One 32-bit lane, the reference every vector kernel must match
+    struct ScalarOps {
+        using reg                  = std::int32_t;
+        static constexpr int LANES = 1;
+
+        static reg  load(const BitRow *source) { return static_cast<reg>(*source); }
+        static void store(int *destination, const reg value) { *destination = value; }
+        static reg  set1(const int value) { return value; }
+
+        static reg add(const reg a, const reg b) { return a + b; }
+        static reg sub(const reg a, const reg b) { return a - b; }
+        static reg and_(const reg a, const reg b) { return a & b; }
+        static reg or_(const reg a, const reg b) { return a | b; }
+        static reg xor_(const reg a, const reg b) { return a ^ b; }
+        static reg andnot(const reg a, const reg b) { return ~a & b; }
+        static reg shl(const reg a, const int n) { return static_cast<reg>(static_cast<std::uint32_t>(a) << n); }
+        static reg shr(const reg a, const int n) { return static_cast<reg>(static_cast<std::uint32_t>(a) >> n); }
+        static reg min(const reg a, const reg b) { return a < b ? a : b; }
+        static reg max(const reg a, const reg b) { return a > b ? a : b; }
+        static reg abs(const reg a) { return a < 0 ? -a : a; }
+    };
+
+#if TETRIS_X86 && defined(TETRIS_BATCH_SSE2)
+    // Four 32-bit lanes, SSE2 only (no SSE4.1 min/max/abs, emulated with compares)
+    struct Sse2Ops {
+        using reg                  = __m128i;
+        static constexpr int LANES = 4;
+
+        static reg  load(const BitRow *source) { return _mm_load_si128(reinterpret_cast<const __m128i *>(source)); }
+        static void store(int *destination, const reg value) { _mm_store_si128(reinterpret_cast<__m128i *>(destination), value); }
+        static reg  set1(const int value) { return _mm_set1_epi32(value); }
+
+        static reg add(const reg a, const reg b) { return _mm_add_epi32(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm_sub_epi32(a, b); }
+        static reg and_(const reg a, const reg b) { return _mm_and_si128(a, b); }
+        static reg or_(const reg a, const reg b) { return _mm_or_si128(a, b); }
+        static reg xor_(const reg a, const reg b) { return _mm_xor_si128(a, b); }
+        static reg andnot(const reg a, const reg b) { return _mm_andnot_si128(a, b); }
+        static reg shl(const reg a, const int n) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+        static reg shr(const reg a, const int n) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+        static reg min(const reg a, const reg b) {
+            const auto greater = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+        }
+        static reg max(const reg a, const reg b) {
+            const auto greater = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+        }
+        static reg abs(const reg a) {
+            const auto sign = _mm_srai_epi32(a, 31);
+            return _mm_sub_epi32(_mm_xor_si128(a, sign), sign);
+        }
+    };
+#endif
+
+#if TETRIS_X86 && defined(TETRIS_BATCH_AVX2)
+    // Eight 32-bit lanes
+    struct Avx2Ops {
+        using reg                  = __m256i;
+        static constexpr int LANES = 8;
+
+        static reg  load(const BitRow *source) { return _mm256_load_si256(reinterpret_cast<const __m256i *>(source)); }
+        static void store(int *destination, const reg value) { _mm256_store_si256(reinterpret_cast<__m256i *>(destination), value); }
+        static reg  set1(const int value) { return _mm256_set1_epi32(value); }
+
+        static reg add(const reg a, const reg b) { return _mm256_add_epi32(a, b); }
+        static reg sub(const reg a, const reg b) { return _mm256_sub_epi32(a, b); }
+        static reg and_(const reg a, const reg b) { return _mm256_and_si256(a, b); }
+        static reg or_(const reg a, const reg b) { return _mm256_or_si256(a, b); }
+        static reg xor_(const reg a, const reg b) { return _mm256_xor_si256(a, b); }
+        static reg andnot(const reg a, const reg b) { return _mm256_andnot_si256(a, b); }
+        static reg shl(const reg a, const int n) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+        static reg shr(const reg a, const int n) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+        static reg min(const reg a, const reg b) { return _mm256_min_epi32(a, b); }
+        static reg max(const reg a, const reg b) { return _mm256_max_epi32(a, b); }
+        static reg abs(const reg a) { return _mm256_abs_epi32(a); }
+    };
+#endif
+
+    // Count the set bits of every lane (SWAR, no popcount instruction needed)
+    template<typename Ops>
+    typename Ops::reg popcount(typename Ops::reg value) {
+        value = Ops::sub(value, Ops::and_(Ops::shr(value, 1), Ops::set1(0x55555555)));
+        value = Ops::add(Ops::and_(value, Ops::set1(0x33333333)), Ops::and_(Ops::shr(value, 2), Ops::set1(0x33333333)));
+        value = Ops::and_(Ops::add(value, Ops::shr(value, 4)), Ops::set1(0x0F0F0F0F));
+        value = Ops::add(value, Ops::shr(value, 8));
+        value = Ops::add(value, Ops::shr(value, 16));
+        return Ops::and_(value, Ops::set1(0x3F));
+    }
+
+    // Compute the features of the first boards of a batch, Ops::LANES boards at a time
+    template<typename Ops>
+    void compute_features(const BitRow (*rows)[BOARD_BATCH_SIZE], const int count, BoardBatchFeatures &features) {
+        using reg = typename Ops::reg;
+
+        constexpr int WIDTH  = Bitboard::WIDTH;
+        constexpr int HEIGHT = Bitboard::HEIGHT;
+
+        const auto one   = Ops::set1(1);
+        const auto walls = Ops::set1(1 | 1 << (WIDTH + 1));    // Both walls around a row shifted by one column
+        const auto pairs = Ops::set1((1 << (WIDTH + 1)) - 1); // Every pair of neighbouring cells, walls included
+
+        for (int lane = 0; lane < count; lane += Ops::LANES) {
+            reg covered     = Ops::set1(0); // Columns with a filled cell in the rows above
+            reg holes       = Ops::set1(0);
+            reg transitions = Ops::set1(0);
+            reg heights[WIDTH];
+            for (auto &height : heights) { height = Ops::set1(0); }
+
+            for (int y = 0; y < HEIGHT; ++y) {
+                const auto row = Ops::load(&rows[y][lane]);
+
+                holes   = Ops::add(holes, popcount<Ops>(Ops::andnot(row, covered)));
+                covered = Ops::or_(covered, row);
+
+                const auto walled = Ops::or_(Ops::shl(row, 1), walls);
+                transitions       = Ops::add(transitions, popcount<Ops>(Ops::and_(Ops::xor_(walled, Ops::shr(walled, 1)), pairs)));
+
+                // A column is as high as the number of rows at or below its topmost filled cell
+                for (int x = 0; x < WIDTH; ++x) { heights[x] = Ops::add(heights[x], Ops::and_(Ops::shr(covered, x), one)); }
+            }
+
+            reg height    = Ops::set1(0);
+            reg bumpiness = Ops::set1(0);
+            reg wells     = Ops::set1(0);
+            for (int x = 0; x < WIDTH; ++x) {
+                height = Ops::add(height, heights[x]);
+                if (x > 0) { bumpiness = Ops::add(bumpiness, Ops::abs(Ops::sub(heights[x], heights[x - 1]))); }
+
+                const auto left  = x > 0 ? heights[x - 1] : Ops::set1(HEIGHT);
+                const auto right = x + 1 < WIDTH ? heights[x + 1] : Ops::set1(HEIGHT);
+                wells            = Ops::add(wells, Ops::max(Ops::set1(0), Ops::sub(Ops::min(left, right), heights[x])));
+            }
+
+            Ops::store(features.height + lane, height);
+            Ops::store(features.holes + lane, holes);
+            Ops::store(features.bumpiness + lane, bumpiness);
+            Ops::store(features.wells + lane, wells);
+            Ops::store(features.transitions + lane, transitions);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "board-batch.h"
+
+#include <algorithm>
+
+#define TETRIS_BATCH_SSE2
+#include "board-batch-kernel.h"
+
+#if TETRIS_AVX2_KERNEL
+void compute_features_avx2(const BitRow (*rows)[BOARD_BATCH_SIZE], int count, BoardBatchFeatures &features); // board-batch-avx2.cpp
+#endif
+
+void BoardBatch::compute(BoardBatchFeatures &features, const BatchKernel kernel) const {
+    switch (kernel) {
+#if TETRIS_AVX2_KERNEL
+        case BatchKernel::Avx2:
+            compute_features_avx2(rows, count, features);
+            break;
+#endif
+#if TETRIS_X86
+        case BatchKernel::Sse2:
+            compute_features<Sse2Ops>(rows, count, features);
+            break;
+#endif
+        default: // Reference kernel, also taken by the kernels not compiled in
+            compute_features<ScalarOps>(rows, count, features);
+            break;
+    }
+    std::copy_n(lines, count, features.lines);
+}
+
+bool BoardBatch::is_supported(const BatchKernel kernel) {
+    switch (kernel) {
+        case BatchKernel::Scalar:
+            return true;
+        case BatchKernel::Sse2:
+            return TETRIS_X86;
+        case BatchKernel::Avx2:
+#if TETRIS_AVX2_KERNEL && (defined(__GNUC__) || defined(__clang__))
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+BatchKernel BoardBatch::get_best_kernel() {
+    static const auto best = is_supported(BatchKernel::Avx2) ? BatchKernel::Avx2 : is_supported(BatchKernel::Sse2) ? BatchKernel::Sse2 : BatchKernel::Scalar;
+    return best;
+}
+const char *BoardBatch::get_kernel_name(const BatchKernel kernel) {
+    switch (kernel) {
+        case BatchKernel::Scalar:
+            return "scalar";
+        case BatchKernel::Sse2:
+            return "sse2";
+        case BatchKernel::Avx2:
+            return "avx2";
+    }
+    return "unknown";
+}
@@ -0,0 +1,158 @@
+#include "bot.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "zobrist.h"
+
+namespace {
+    // Lock a shape into a board and remove the filled lines, returns the number of removed lines
+    int place(Bitboard &board, const Shape &shape, const Vec2 &landing) {
+        const auto height = shape.get_size().y;
+        board.place(shape.get_mask(), height, landing);
+
+        int lines = 0;
+        for (int y = landing.y + height - 1; y >= 0; --y) {
+            if (board.is_row_full(y)) {
+                ++lines;
+                continue;
+            }
+            board.rows[y + lines] = board.rows[y];
+        }
+        std::fill_n(board.rows.begin(), lines, 0);
+
+        return lines;
+    }
+}
+
+BotMove Bot::find_move(const Game &game) {
+    if (game.is_over()) { return BotMove(); }
+
+    // Every list of the decision lives in the arena of the thread, released at once when the move is found
+    ArenaScope scope(Arena::local());
+    Candidates candidates(&scope.get_arena());
+
+    batch_base = 0;
+    search(game.get_occupancy(), game.get_current_shape(), false, candidates);
+
+    // Try the held shape (or the next one when nothing is held) on a copy of the game
+    if (game.is_swap_allowed()) {
+        auto swapped = game;
+        if (swapped.apply(Action::Hold) && !swapped.is_over()) { search(swapped.get_occupancy(), swapped.get_current_shape(), true, candidates); }
+    }
+    flush(candidates);
+
+    if (candidates.empty()) { return BotMove(); }
+
+    // Keep the first of equal scores, like scoring the placements one by one
+    const auto best = std::max_element(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) { return a.score < b.score; });
+    if (!lookahead) { return make_move(*best, best->score); }
+
+    // Search the best placements one shape deeper, in order of their static score
+    if (table != nullptr) { table->new_search(); }
+
+    std::pmr::vector<int> order(candidates.size(), &scope.get_arena());
+    std::iota(order.begin(), order.end(), 0);
+    const auto width = std::min<std::size_t>(BOT_LOOKAHEAD_WIDTH, order.size());
+    std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(width), order.end(), [&candidates](const int a, const int b) {
+        return candidates[a].score > candidates[b].score || (candidates[a].score == candidates[b].score && a < b);
+    });
+
+    const Candidate *chosen     = nullptr;
+    double           best_value = -std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < width; ++i) {
+        const auto &candidate = candidates[order[i]];
+        const auto  value     = weights.lines * candidate.lines + follow_up(candidate.board);
+        if (value > best_value) {
+            chosen     = &candidate;
+            best_value = value;
+        }
+    }
+    return make_move(*chosen, best_value);
+}
+bool Bot::play(Game &game) {
+    const auto move = find_move(game);
+    if (!move.is_valid()) { return false; }
+
+    move.for_each_action([&game](const Action action) { game.apply(action); });
+    return true;
+}
+
+void Bot::search(const Bitboard &board, const Shape &shape, const bool hold, Candidates &candidates) {
+    auto &generator = generators[hold];
+    generator.generate(board, shape);
+
+    for (const auto &placement : generator) {
+        Candidate candidate{hold, placement, board, 0, 0.0};
+        candidate.lines = place(candidate.board, placement.shape, placement.shape.position);
+
+        batch.add(candidate.board, candidate.lines);
+        candidates.push_back(candidate);
+        if (batch.is_full()) { flush(candidates); }
+    }
+}
+void Bot::flush(Candidates &candidates) {
+    score_batch([this, &candidates](const int index, const double value) { candidates[batch_base + index].score = value; });
+    batch_base = static_cast<int>(candidates.size());
+}
+BotMove Bot::make_move(const Candidate &candidate, const double score) const {
+    BotMove move;
+    move.hold     = candidate.hold;
+    move.path     = generators[candidate.hold].get_path(candidate.placement);
+    move.position = candidate.placement.shape.position;
+    move.score    = score;
+    return move;
+}
+
+float Bot::follow_up(const Bitboard &board) {
+    const auto hash = zobrist_board(board);
+    const auto key  = hash ^ ZOBRIST.depth[1];
+
+    // Every value is rounded to float, computed or cached, so the table never changes a decision
+    TranspositionEntry entry;
+    if (table != nullptr && table->probe(key, entry) && entry.depth >= 1) { return entry.score; }
+
+    double sum = 0;
+    for (unsigned int type = 0; type < SHAPE_COUNT; ++type) { sum += best_placement(board, hash, type); }
+    const auto value = static_cast<float>(sum / SHAPE_COUNT);
+
+    if (table != nullptr) { table->store(key, TranspositionEntry{value, 1}); }
+    return value;
+}
+float Bot::best_placement(const Bitboard &board, const std::uint64_t hash, const unsigned int type) {
+    const auto key = hash ^ ZOBRIST.current[type] ^ ZOBRIST.depth[0];
+
+    TranspositionEntry entry;
+    if (table != nullptr && table->probe(key, entry)) { return entry.score; }
+
+    Shape shape(type);
+    shape.position = shape.get_spawn_position();
+
+    auto       best      = static_cast<float>(BOT_LOSS_SCORE);
+    const auto keep_best = [&best](int, const double value) { best = std::max(best, static_cast<float>(value)); };
+    follow_ups.generate(board, shape);
+    for (const auto &placement : follow_ups) {
+        auto       next  = board;
+        const auto lines = place(next, placement.shape, placement.shape.position);
+        batch.add(next, lines);
+        if (batch.is_full()) { score_batch(keep_best); }
+    }
+    score_batch(keep_best);
+
+    if (table != nullptr) { table->store(key, TranspositionEntry{best, 0}); }
+    return best;
+}
+
+double Bot::evaluate(const Bitboard &board, const int lines) const {
+    BoardBatch single;
+    single.add(board, lines);
+
+    BoardBatchFeatures features;
+    single.compute(features, BatchKernel::Scalar);
+    return score(features, 0);
+}
+double Bot::score(const BoardBatchFeatures &features, const int index) const {
+    return weights.height * features.height[index] + weights.lines * features.lines[index] + weights.holes * features.holes[index] +
+           weights.bumpiness * features.bumpiness[index] + weights.wells * features.wells[index] + weights.transitions * features.transitions[index];
+}
@@ -0,0 +1,146 @@
+#include "broadcast.h"
+
+// Bytes a viewer gets before any frame, and after quitting: the telnet modes and the alternate screen
+static const FrameRef SPECTATOR_GREETING = std::make_shared<const EncodedFrame>(EncodedFrame{std::string(TelnetParser::GREETING).append(ANSI_SCREEN_ENTER), 0, false});
+static const FrameRef SPECTATOR_FAREWELL = std::make_shared<const EncodedFrame>(EncodedFrame{std::string(ANSI_SCREEN_LEAVE), 0, false});
+
+Broadcast::Broadcast(const Vec2 &size) : renderer(size) { encoder.resize(size); }
+
+FrameRef Broadcast::publish(const Game &game) {
+    renderer.update();
+    scene.draw(renderer, game);
+
+    // Every delta sets the cursor and color it starts with, so it also applies after a keyframe
+    renderer.forget_screen();
+    renderer.refresh();
+
+    const auto bytes = renderer.get_output();
+    if (bytes.empty()) { return nullptr; }
+    return std::make_shared<const EncodedFrame>(EncodedFrame{std::string(bytes), ++sequence, false});
+}
+
+FrameRef Broadcast::get_keyframe() {
+    if (keyframe && keyframe->sequence == sequence) { return keyframe; }
+
+    // A cleared screen already shows every blank cell, only the others are written
+    const auto &frame = renderer.get_frame();
+    const auto  size  = frame.get_size();
+    encoder.reset();
+    encoder.begin_frame();
+    encoder.clear_screen();
+    for (int y = 0; y < size.y; ++y) {
+        int x = 0;
+        while (x < size.x) {
+            if (frame(x, y) == Cell()) {
+                ++x;
+                continue;
+            }
+
+            int end = x + 1;
+            while (end < size.x && frame(end, y) != Cell()) { ++end; }
+            encoder.write_span(x, y, &frame(x, y), end - x);
+            x = end;
+        }
+    }
+
+    keyframe = std::make_shared<const EncodedFrame>(EncodedFrame{std::string(encoder.end_frame()), sequence, true});
+    ++keyframes;
+    return keyframe;
+}
+
+Spectator::Spectator(const std::size_t limit) : limit(limit) { push(SPECTATOR_GREETING); }
+
+void Spectator::watch(Broadcast &watched) {
+    // The farewell left the alternate screen, nothing may be drawn after it
+    if (closed) { return; }
+
+    broadcast = &watched;
+    resume();
+}
+
+bool Spectator::offer(const FrameRef &frame) {
+    // Frames up to the keyframe the viewer started from are already on its screen
+    if (broadcast == nullptr || closed || frame->sequence <= sequence) { return true; }
+
+    if (queued + frame->bytes.size() <= limit) {
+        push(frame);
+        sequence = frame->sequence;
+        return true;
+    }
+
+    // Still behind with a keyframe queued: skipping more would not help
+    if (pending > 0) { return false; }
+    resume();
+    return true;
+}
+
+void Spectator::receive(const std::string_view bytes) {
+    std::string data;
+    std::string replies;
+    telnet.feed(bytes, data, replies);
+
+    // Replies go out between whole frames, like any frame they are shared by nobody else
+    if (!replies.empty() && !closed) { push(std::make_shared<const EncodedFrame>(EncodedFrame{std::move(replies), 0, false})); }
+    if (!closed && data.find('q') != std::string::npos) {
+        closed = true;
+        push(SPECTATOR_FAREWELL);
+    }
+}
+
+int Spectator::gather(iovec *vectors, const int count) const {
+    int  filled = 0;
+    auto skip   = offset;
+    for (auto it = queue.begin(); it != queue.end() && filled < count; ++it) {
+        const auto &bytes        = (*it)->bytes;
+        vectors[filled].iov_base = const_cast<char *>(bytes.data() + skip); // writev takes the buffers as mutable, it only reads them
+        vectors[filled].iov_len  = bytes.size() - skip;
+        ++filled;
+        skip = 0;
+    }
+    return filled;
+}
+
+void Spectator::consume(std::size_t count) {
+    queued -= count;
+    while (count > 0) {
+        const auto left = queue.front()->bytes.size() - offset;
+        if (count < left) {
+            offset += count;
+            return;
+        }
+
+        count -= left;
+        if (queue.front()->keyframe) { --pending; }
+        queue.pop_front();
+        offset = 0;
+    }
+}
+
+void Spectator::push(const FrameRef &frame) {
+    queued += frame->bytes.size();
+    queue.push_back(frame);
+}
+
+void Spectator::resume() {
+    // The frame being sent goes out whole, a terminal cannot take half an escape sequence, and so do the bytes that
+    // are not frames of a broadcast
+    std::size_t kept = offset > 0 ? 1 : 0;
+    for (std::size_t i = kept; i < queue.size(); ++i) {
+        if (queue[i]->sequence == 0 && !queue[i]->keyframe) {
+            if (i != kept) { queue[kept] = std::move(queue[i]); }
+            ++kept;
+            continue;
+        }
+
+        queued -= queue[i]->bytes.size();
+        if (queue[i]->keyframe) { --pending; }
+        else { ++skipped; }
+    }
+    queue.resize(kept);
+
+    const auto keyframe = broadcast->get_keyframe();
+    push(keyframe);
+    sequence = keyframe->sequence;
+    ++pending;
+    ++keyframes;
+}
@@ -0,0 +1,292 @@
+#include "game.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "metrics.h"
+#include "shape.h"
+#include "zobrist.h"
+
+void Game::init() { init(Random::entropy()); }
+void Game::init(const std::uint64_t seed) {
+    this->seed = seed;
+    rng.seed(seed);
+
+    // Start from an empty grid
+    set_grid(GameGrid());
+
+    shapes_pool.clear();
+    held_shape    = Shape();
+    can_swap      = true;
+    over          = false;
+    pieces_placed = 0;
+    lines_cleared = 0;
+    last_clear    = LineClear();
+    ticks         = 0;
+
+    over = !next_shape();
+}
+
+bool Game::apply(const Action action) {
+    if (over) { return false; }
+
+    switch (action) {
+        case Action::Left: // Move shape left
+            return translate_shape(Vec2(-1, 0));
+        case Action::Right: // Move shape right
+            return translate_shape(Vec2(1, 0));
+        case Action::SoftDrop: // Move shape down
+            return translate_shape(Vec2(0, 1));
+        case Action::Rotate: // Rotate shape clockwise
+            return rotate_shape();
+        case Action::HardDrop: // Place shape immediately
+            land_shape(); // Always a valid position, no need to check it again
+            place_shape();
+            over = !next_shape();
+            return true;
+        case Action::Hold: // Swap shapes
+            return swap_shapes();
+    }
+
+    return false;
+}
+bool Game::tick() {
+    if (over) { return false; }
+    ++ticks;
+
+    if (!translate_shape(Vec2(0, 1))) {
+        place_shape();
+        over = !next_shape();
+    }
+
+    return true;
+}
+
+bool Game::next_shape() {
+    if (shapes_pool.empty()) {
+        shapes_pool.refill();                                         // All shape indices
+        Random::shuffle(shapes_pool.begin(), shapes_pool.end(), rng); // Shuffle the shape indices
+    }
+
+    // Generate a new random shape
+    const auto shape_index = shapes_pool.back();
+    shapes_pool.pop_back();
+
+    current_shape = Shape(shape_index);
+    return spawn_shape();
+}
+bool Game::spawn_shape() {
+    // Put the current shape at its spawn position, even if it does not fit there
+    current_shape.position = current_shape.get_spawn_position();
+    if (!is_shape_placeable(current_shape, current_shape.position)) { return false; }
+
+    update_landing_position();
+    return true;
+}
+bool Game::move_shape(const Vec2 &position) {
+    // Check if the new position is within bounds
+    if (!is_shape_inbounds(current_shape, position)) { return false; }
+
+    // Check if the new position intersects with existing blocks
+    if (is_shape_intersecting(current_shape, position)) { return false; }
+
+    // Update the current shape's position
+    current_shape.position = position;
+    update_landing_position();
+
+    return true;
+}
+bool Game::rotate_shape() {
+    const auto next_shape = current_shape.rotated_clockwise();
+    if (is_shape_placeable(next_shape, current_shape.position)) {
+        current_shape.rotation = next_shape.rotation; // Update rotation if valid
+        update_landing_position();
+        return true;
+    }
+
+    // Try to compensate the rotation by shifting the shape up
+    const auto compensated_position = current_shape.position + Vec2(0, -1);
+    if (is_shape_placeable(next_shape, compensated_position)) {
+        current_shape.rotation = next_shape.rotation; // Update rotation if
+        move_shape(compensated_position);             // Update position if valid
+        return true;
+    }
+
+    return false;
+}
+void Game::update_landing_position() {
+    const auto &rotation = current_shape.get_rotation();
+    const auto  position = current_shape.position;
+
+    // Drop onto the skyline when every column of the shape is above the stack
+    bool above_stack = true;
+    int  landing_y   = GAME_GRID_HEIGHT;
+    for (int x = 0; x < rotation.size.x; ++x) {
+        const auto column_top = GAME_GRID_HEIGHT - skyline[position.x + x];
+        above_stack           = above_stack && position.y + rotation.bottom[x] < column_top;
+        landing_y             = std::min(landing_y, column_top - 1 - rotation.bottom[x]);
+    }
+    if (above_stack) {
+        landing_position = Vec2(position.x, landing_y);
+        return;
+    }
+
+    // The shape is tucked under an overhang, step down row by row
+    landing_position           = current_shape.position;
+    Vec2 next_landing_position = current_shape.position + Vec2(0, 1);
+
+    while (is_shape_placeable(current_shape, next_landing_position)) {
+        landing_position = next_landing_position;
+        next_landing_position += Vec2(0, 1);
+    }
+}
+
+void Game::land_shape() { current_shape.position = landing_position; }
+void Game::place_shape() {
+    can_swap = true; // Allow swapping shapes again after placing the current shape
+    ++pieces_placed;
+
+    // Place the shape on the grid at its current position
+    const auto size = current_shape.get_size();
+    for (int y = 0; y < size.y; ++y) {
+        for (int x = 0; x < size.x; ++x) {
+            if (const auto grid_value = current_shape.get_block(x, y); grid_value != 0) {
+                grid(current_shape.position.x + x, current_shape.position.y + y) = grid_value;
+            }
+        }
+    }
+    occupancy.place(current_shape.get_mask(), size.y, current_shape.position);
+    for (int y = 0; y < size.y; ++y) { board_hash ^= zobrist_row(current_shape.position.y + y, current_shape.get_mask()[y] << current_shape.position.x); }
+
+    // Raise the skyline under the placed shape
+    const auto &rotation = current_shape.get_rotation();
+    for (int x = 0; x < size.x; ++x) {
+        auto &height = skyline[current_shape.position.x + x];
+        height       = std::max(height, GAME_GRID_HEIGHT - current_shape.position.y - rotation.top[x]);
+    }
+
+    last_clear = remove_filled_lines(current_shape.position.y, size.y);
+}
+bool Game::swap_shapes() {
+    if (!can_swap) { return false; }
+
+    if (held_shape.is_valid()) {
+        std::swap(current_shape, held_shape);
+        over = !spawn_shape();
+    } else {
+        held_shape = current_shape;
+        over       = !next_shape();
+    }
+
+    can_swap = false; // Prevent swapping again until the next shape is placed
+    return true;
+}
+
+LineClear Game::remove_filled_lines(int top, int height) {
+    assert(height <= BITBOARD_SHAPE_ROWS && top >= 0 && top + height <= GAME_GRID_HEIGHT);
+
+    // Keep to the rows of the grid, and to as many as a shape can fill
+    top    = std::clamp(top, 0, GAME_GRID_HEIGHT);
+    height = std::clamp(height, 0, std::min(BITBOARD_SHAPE_ROWS, GAME_GRID_HEIGHT - top));
+
+    LineClear clear;
+
+    // Only the given rows can have been filled by the last placement
+    for (int y = top; y < top + height; ++y) {
+        if (occupancy.is_row_full(y)) { clear.rows[clear.count++] = y; }
+    }
+    if (clear.count == 0) { return clear; }
+
+    const auto width  = grid.get_width();
+    const auto bottom = clear.rows[clear.count - 1];
+
+    // Every row down to the lowest removed one changes, hash them out before and back in after
+    for (int y = 0; y <= bottom; ++y) { board_hash ^= zobrist_row(y, occupancy.rows[y]); }
+
+    // Compact the surviving rows of the range, moving each of them once
+    int destination = clear.rows[clear.count - 1];
+    for (int source = destination - 1, removed = clear.count - 1; source >= top; --source) {
+        if (removed > 0 && clear.rows[removed - 1] == source) {
+            --removed;
+            continue;
+        }
+        std::copy_n(grid.get_row(source), width, grid.get_row(destination));
+        occupancy.rows[destination] = occupancy.rows[source];
+        --destination;
+    }
+
+    // Every row above the range moves down by the same distance, as one block
+    std::copy_backward(grid.get_row(0), grid.get_row(top), grid.get_row(top + clear.count));
+    std::copy_backward(occupancy.rows.begin(), occupancy.rows.begin() + top, occupancy.rows.begin() + top + clear.count);
+
+    // Clear the top rows
+    std::fill_n(grid.get_row(0), clear.count * width, 0);
+    std::fill_n(occupancy.rows.begin(), clear.count, 0);
+
+    for (int y = 0; y <= bottom; ++y) { board_hash ^= zobrist_row(y, occupancy.rows[y]); }
+    skyline = occupancy.column_heights();
+
+    lines_cleared += clear.count;
+    count_metric(Counter::LinesCleared, clear.count);
+    return clear;
+}
+
+bool Game::is_shape_inbounds(const Shape &shape, const Vec2 &pos) const {
+    // Check if the shape is within the grid bounds
+    const auto size = shape.get_size();
+    return pos.x >= 0 && pos.x + size.x <= grid.get_width() &&
+           pos.y >= 0 && pos.y + size.y <= grid.get_height();
+}
+bool Game::is_shape_intersecting(const Shape &shape, const Vec2 &pos) const {
+    return occupancy.intersects(shape.get_mask(), shape.get_size().y, pos);
+}
+bool Game::is_shape_placeable(const Bitboard &board, const Shape &shape, const Vec2 &pos) {
+    count_metric(Counter::CollisionChecks);
+
+    const auto size = shape.get_size();
+    return pos.x >= 0 && pos.x + size.x <= Bitboard::WIDTH && pos.y >= 0 && pos.y + size.y <= Bitboard::HEIGHT &&
+           !board.intersects(shape.get_mask(), size.y, pos);
+}
+
+void Game::set_grid(const GameGrid &new_grid) {
+    grid       = new_grid;
+    occupancy  = Bitboard::from_grid(grid);
+    skyline    = occupancy.column_heights();
+    board_hash = zobrist_board(occupancy);
+
+    if (current_shape.is_valid()) { update_landing_position(); }
+}
+
+std::uint64_t Game::get_checksum() const {
+    // FNV-1a over everything that defines the game state
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    const auto    mix  = [&hash](const std::uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001B3ull;
+    };
+
+    for (int i = 0; i < grid.get_size(); ++i) { mix(grid.get_raw()[i]); }
+    for (const auto shape_index : shapes_pool) { mix(shape_index); }
+    for (const auto &shape : {current_shape, held_shape}) {
+        mix(shape.type);
+        mix(shape.rotation);
+        mix(static_cast<std::uint32_t>(shape.position.x));
+        mix(static_cast<std::uint32_t>(shape.position.y));
+    }
+    mix(can_swap);
+    mix(over);
+    mix(pieces_placed);
+    mix(lines_cleared);
+    mix(ticks);
+
+    return hash;
+}
+std::uint64_t Game::get_hash() const {
+    // The cells are hashed incrementally, the few shape and bag keys are folded in on demand
+    auto hash = board_hash;
+    if (current_shape.is_valid()) { hash ^= ZOBRIST.current[current_shape.type]; }
+    if (held_shape.is_valid()) { hash ^= ZOBRIST.held[held_shape.type]; }
+    for (std::size_t i = 0; i < shapes_pool.size(); ++i) { hash ^= ZOBRIST.bag[i][shapes_pool[i]]; }
+    if (!can_swap) { hash ^= ZOBRIST.swap_used; }
+    return hash;
+}
@@ -0,0 +1,60 @@
+#include "metrics.h"
+
+#include <cstdio>
+#include <memory>
+
+bool Metrics::dump(const std::string &path) const {
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file(std::fopen(path.c_str(), "w"), std::fclose);
+    if (!file) { return false; }
+
+    // Summary of every phase, then the non-empty buckets as "lower upper count" rows to plot the full distributions
+    std::fprintf(file.get(), "# phase durations (ns)\n");
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        const auto &histogram = phases[i];
+        std::fprintf(file.get(), "%s count %llu mean %.1f p50 %llu p90 %llu p99 %llu max %llu\n", get_phase_name(static_cast<Phase>(i)),
+                     static_cast<unsigned long long>(histogram.get_count()), histogram.get_mean(), static_cast<unsigned long long>(histogram.percentile(50)),
+                     static_cast<unsigned long long>(histogram.percentile(90)), static_cast<unsigned long long>(histogram.percentile(99)),
+                     static_cast<unsigned long long>(histogram.get_max()));
+    }
+
+    std::fprintf(file.get(), "# counters\n");
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+        std::fprintf(file.get(), "%s %llu\n", get_counter_name(static_cast<Counter>(i)), static_cast<unsigned long long>(counters[i]));
+    }
+
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        std::fprintf(file.get(), "# buckets %s\n", get_phase_name(static_cast<Phase>(i)));
+        for (int bucket = 0; bucket < Histogram::BUCKETS; ++bucket) {
+            if (const auto count = phases[i].get_bucket_count(bucket); count != 0) {
+                std::fprintf(file.get(), "%llu %llu %llu\n", static_cast<unsigned long long>(Histogram::bucket_lower(bucket)),
+                             static_cast<unsigned long long>(Histogram::bucket_upper(bucket)), static_cast<unsigned long long>(count));
+            }
+        }
+    }
+
+    return std::ferror(file.get()) == 0;
+}
+
+const char *Metrics::get_phase_name(const Phase phase) {
+    switch (phase) {
+        case Phase::Input: return "input";
+        case Phase::Bot: return "bot";
+        case Phase::Tick: return "tick";
+        case Phase::Update: return "update";
+        case Phase::Draw: return "draw";
+        case Phase::Refresh: return "refresh";
+        case Phase::Frame: return "frame";
+        case Phase::Count: break;
+    }
+    return "?";
+}
+const char *Metrics::get_counter_name(const Counter counter) {
+    switch (counter) {
+        case Counter::CollisionChecks: return "collisions";
+        case Counter::CellsDrawn: return "cells_drawn";
+        case Counter::CellsChanged: return "cells_changed";
+        case Counter::LinesCleared: return "lines";
+        case Counter::Count: break;
+    }
+    return "?";
+}
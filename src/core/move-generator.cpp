@@ -0,0 +1,102 @@
+#include "move-generator.h"
+
+#include <algorithm>
+#include <bit>
+
+void MoveGenerator::compute_collisions(const Bitboard &board) {
+    const auto &rotations = Shape::ROTATIONS[shape.type];
+
+    // Nothing collides above the topmost occupied row
+    int top = 0;
+    while (top < Bitboard::HEIGHT && board.is_row_empty(top)) { ++top; }
+
+    for (int rotation = 0; rotation < SHAPE_ROTATIONS; ++rotation) {
+        // Rotations with the same cells (O, and the halves of I, S and Z) share their columns
+        canonical[rotation] = rotation;
+        for (int other = 0; other < rotation; ++other) {
+            if (rotations[other].mask == rotations[rotation].mask) {
+                canonical[rotation] = other;
+                std::copy_n(blocked[other], Bitboard::WIDTH, blocked[rotation]);
+                break;
+            }
+        }
+        if (canonical[rotation] != rotation) { continue; }
+
+        const auto &state = rotations[rotation];
+        for (int x = 0; x < Bitboard::WIDTH; ++x) {
+            if (x + state.size.x > Bitboard::WIDTH) {
+                blocked[rotation][x] = ~Column{0};
+                continue;
+            }
+
+            // Every row past the bottom is blocked, so a drop always stops
+            auto column = ~Column{0} << (Bitboard::HEIGHT - state.size.y + 1);
+            for (int y = std::max(0, top - state.size.y + 1); y <= Bitboard::HEIGHT - state.size.y; ++y) {
+                if (board.intersects(state.mask, state.size.y, Vec2(x, y))) { column |= Column{1} << y; }
+            }
+            blocked[rotation][x] = column;
+        }
+    }
+}
+
+int MoveGenerator::generate(const Bitboard &board, const Shape &shape) {
+    this->shape = shape;
+    count       = 0;
+    explored    = 0;
+
+    compute_collisions(board);
+    std::fill_n(&visited[0][0], SHAPE_ROTATIONS * Bitboard::WIDTH, 0);
+    std::fill_n(&locked[0][0], SHAPE_ROTATIONS * Bitboard::WIDTH, 0);
+
+    const auto is_free = [this](const int rotation, const int x, const int y) { return y >= 0 && ((blocked[rotation][x] >> y) & 1) == 0; };
+
+    const auto position = shape.position;
+    if (position.x < 0 || position.x >= Bitboard::WIDTH || !is_free(shape.rotation, position.x, position.y)) { return 0; }
+
+    int tail = 0;
+    // States whose rotations share their cells have the same future, only the first one reached is searched
+    const auto visit = [&](const std::uint16_t parent, const int rotation, const int x, const int y, const Action move) {
+        auto &column = visited[canonical[rotation]][x];
+        if ((column >> y) & 1) { return; }
+        column |= Column{1} << y;
+
+        const auto state = encode(rotation, x, y);
+        parents[state]   = parent;
+        moves[state]     = move;
+        queue[tail++]    = state;
+    };
+
+    start = encode(shape.rotation, position.x, position.y);
+    visit(start, shape.rotation, position.x, position.y, Action::HardDrop);
+
+    for (int head = 0; head < tail; ++head) {
+        const auto state    = queue[head];
+        const auto y        = state % Bitboard::HEIGHT;
+        const auto x        = state / Bitboard::HEIGHT % Bitboard::WIDTH;
+        const auto rotation = state / (Bitboard::HEIGHT * Bitboard::WIDTH);
+
+        // The hard drop from this state, the first state found to reach a lock position has its shortest path
+        const auto landing = y + std::countr_zero(blocked[rotation][x] >> (y + 1));
+        if (auto &column = locked[canonical[rotation]][x]; ((column >> landing) & 1) == 0) {
+            column |= Column{1} << landing;
+
+            auto &placement          = placements[count++];
+            placement.shape          = Shape(shape.type);
+            placement.shape.rotation = static_cast<unsigned char>(rotation);
+            placement.shape.position = Vec2(x, landing);
+            placement.state          = state;
+        }
+
+        // Same rule as Action::Rotate: rotate in place, or one row higher
+        const auto rotated = (rotation + 1) % SHAPE_ROTATIONS;
+        if (is_free(rotated, x, y)) { visit(state, rotated, x, y, Action::Rotate); }
+        else if (is_free(rotated, x, y - 1)) { visit(state, rotated, x, y - 1, Action::Rotate); }
+
+        if (x > 0 && is_free(rotation, x - 1, y)) { visit(state, rotation, x - 1, y, Action::Left); }
+        if (x + 1 < Bitboard::WIDTH && is_free(rotation, x + 1, y)) { visit(state, rotation, x + 1, y, Action::Right); }
+        if (is_free(rotation, x, y + 1)) { visit(state, rotation, x, y + 1, Action::SoftDrop); }
+    }
+
+    explored = tail;
+    return count;
+}
@@ -0,0 +1,182 @@
+#include "renderer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <poll.h>
+#include <thread>
+
+#include "metrics.h"
+
+#include "configs/symbols.h"
+
+void Renderer::update() {
+    overbound = false; // Reset the overbound flag
+    resized   = false; // Reset the resized flag
+
+    if (const auto new_size = query_size(); size != new_size) {
+        resized = true;
+        size    = new_size;
+        on_resize();        // Let the backend forget what the terminal shows
+        frame.resize(size); // Start over with an empty frame
+    }
+}
+
+void Renderer::refresh() {
+    if (overbound) {
+        clear();
+
+        set_color(Colors::Red, true);
+
+        const auto center = get_size() / 2;
+        draw_text(Vec2(center.x - 7, center.y), L"Out of bounds!");
+
+        set_color(Colors::Default);
+    }
+
+    // Push only the cells that changed since the last frame
+    count_metric(Counter::CellsChanged, present());
+}
+
+bool Renderer::wait_input(const std::chrono::milliseconds timeout) {
+    // No input to wait for, only keep the pace of the loop
+    std::this_thread::sleep_for(timeout);
+    return false;
+}
+bool Renderer::poll_input(const int input, const std::chrono::milliseconds timeout) {
+    pollfd request{input, POLLIN, 0};
+    return poll(&request, 1, static_cast<int>(std::max<long long>(timeout.count(), 0))) > 0;
+}
+
+void Renderer::put_cell(const int x, const int y, const wchar_t symbol) {
+    if (!frame.contains(x, y)) {
+        overbound = true; // Set the overbound flag if the coordinates are out of bounds
+        return;
+    }
+
+    frame(x, y) = Cell{symbol, color};
+    count_metric(Counter::CellsDrawn);
+}
+
+void Renderer::set_color(Colors color, const bool inverted) {
+    short new_color;
+    if (inverted) {
+        new_color = COLOR_INVERTED_OFFSET + static_cast<short>(color);
+    } else {
+        new_color = static_cast<short>(color);
+    }
+    this->color = new_color; // Applied to the cells drawn from now on
+}
+
+void Renderer::draw_pixel(const int x, const int y, const wchar_t symbol) {
+    // A pixel is two cells wide
+    put_cell(x, y, symbol);
+    put_cell(x + 1, y, symbol);
+}
+
+void Renderer::draw_char(const int x, const int y, const wchar_t symbol) { put_cell(x, y, symbol); }
+
+void Renderer::draw_grid(const GameGrid &grid, const Vec2 origin) {
+    for (int y = 0; y < grid.get_height(); ++y) {
+        for (int x = 0; x < grid.get_width(); ++x) {
+            if (const auto value = grid(x, y); value != 0) {
+                set_color(static_cast<Colors>(value + 2), true);
+            } else {
+                set_color(Colors::Black, false);
+            }
+
+            draw_pixel(origin.x + x * 2, origin.y + y, SYMBOL_EMPTY);
+        }
+    }
+
+    set_color(Colors::Default, false);
+}
+
+void Renderer::draw_shape(const Shape &shape, const Vec2 pos, const bool is_shadow) {
+    // Draw the shape on the grid
+    const auto size = shape.get_size();
+    for (int y = 0; y < size.y; ++y) {
+        for (int x = 0; x < size.x; ++x) {
+            if (const auto block = shape.get_block(x, y); block != 0) {
+                set_color(static_cast<Colors>(block + 2), !is_shadow);
+                draw_pixel(pos.x + x * 2, pos.y + y, is_shadow ? SYMBOL_SHADOW : SYMBOL_EMPTY);
+            }
+        }
+    }
+
+    set_color(Colors::Default, false);
+}
+
+void Renderer::draw_pixel_line(const Vec2 &start, const Vec2 &end, const wchar_t symbol) {
+    const int dx    = end.x - start.x;
+    const int dy    = end.y - start.y;
+    const int steps = std::max(abs(dx), abs(dy));
+
+    const auto x_inc = static_cast<float>(dx) / static_cast<float>(steps);
+    const auto y_inc = static_cast<float>(dy) / static_cast<float>(steps);
+
+    auto x = static_cast<float>(start.x);
+    auto y = static_cast<float>(start.y);
+
+    for (int i = 0; i <= steps; ++i) {
+        draw_pixel(static_cast<int>(x), static_cast<int>(y), symbol);
+        x += x_inc;
+        y += y_inc;
+    }
+}
+
+void Renderer::draw_line(const Vec2 &start, const Vec2 &end, wchar_t symbol) {
+    const int dx    = end.x - start.x;
+    const int dy    = end.y - start.y;
+    const int steps = std::max(abs(dx), abs(dy));
+
+    const auto x_inc = static_cast<float>(dx) / static_cast<float>(steps);
+    const auto y_inc = static_cast<float>(dy) / static_cast<float>(steps);
+
+    auto x = static_cast<float>(start.x);
+    auto y = static_cast<float>(start.y);
+
+    for (int i = 0; i <= steps; ++i) {
+        draw_char(static_cast<int>(x), static_cast<int>(y), symbol);
+        x += x_inc;
+        y += y_inc;
+    }
+}
+void Renderer::draw_box(const Vec2 &min, const Vec2 &max, const wchar_t symbol) {
+    for (int y = min.y; y <= max.y; ++y) {
+        for (int x = min.x; x <= max.x; ++x) {
+            draw_char(x, y, symbol);
+        }
+    }
+}
+
+void Renderer::draw_border(const Vec2 &min, const Vec2 &max) {
+    // Draw the top border
+    draw_line(Vec2(min.x, min.y), Vec2(max.x, min.y), SYMBOL_BORDER_HORIZONTAL);
+    // Draw the bottom border
+    draw_line(Vec2(min.x, max.y), Vec2(max.x, max.y), SYMBOL_BORDER_HORIZONTAL);
+    // Draw the left border
+    draw_line(Vec2(min.x, min.y), Vec2(min.x, max.y), SYMBOL_BORDER_VERTICAL);
+    // Draw the right border
+    draw_line(Vec2(max.x, min.y), Vec2(max.x, max.y), SYMBOL_BORDER_VERTICAL);
+
+    // Draw corners
+    draw_char(min.x, min.y, SYMBOL_BORDER_TOP_LEFT);
+    draw_char(max.x, min.y, SYMBOL_BORDER_TOP_RIGHT);
+    draw_char(min.x, max.y, SYMBOL_BORDER_BOTTOM_LEFT);
+    draw_char(max.x, max.y, SYMBOL_BORDER_BOTTOM_RIGHT);
+}
+
+void Renderer::draw_text(const Vec2 &pos, const wchar_t *str) {
+    for (int i = 0; str[i] != L'\0'; ++i) { put_cell(pos.x + i, pos.y, str[i]); }
+}
+
+std::wstring MemoryRenderer::get_text() const {
+    const auto   frame_size = frame.get_size();
+    std::wstring text;
+    text.reserve((frame_size.x + 1) * frame_size.y);
+    for (int y = 0; y < frame_size.y; ++y) {
+        for (int x = 0; x < frame_size.x; ++x) { text += frame(x, y).glyph; }
+        text += L'\n';
+    }
+    return text;
+}
@@ -0,0 +1,162 @@
+#include "replay.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+// --- Decoding ---
+
+namespace {
+    std::uint64_t read_u64(const unsigned char *data) {
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; --i) { value = value << 8 | data[i]; }
+        return value;
+    }
+
+    std::uint64_t read_varint(const std::vector<unsigned char> &bytes, std::size_t &offset) {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (offset >= bytes.size()) { throw std::runtime_error("Truncated replay"); }
+
+            const auto byte = bytes[offset++];
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) { return value; }
+        }
+        throw std::runtime_error("Malformed replay varint");
+    }
+}
+
+Replay Replay::load(const std::string &path) {
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file(std::fopen(path.c_str(), "rb"), std::fclose);
+    if (!file) { throw std::runtime_error("Cannot open replay " + path); }
+
+    std::vector<unsigned char> bytes;
+    unsigned char              chunk[4096];
+    while (const auto count = std::fread(chunk, 1, sizeof(chunk), file.get())) { bytes.insert(bytes.end(), chunk, chunk + count); }
+
+    return parse(bytes);
+}
+Replay Replay::parse(const std::vector<unsigned char> &bytes) {
+    if (bytes.size() < REPLAY_HEADER_SIZE || !std::equal(std::begin(REPLAY_MAGIC), std::end(REPLAY_MAGIC), bytes.begin())) {
+        throw std::runtime_error("Not a replay");
+    }
+    if (bytes[4] != REPLAY_VERSION) { throw std::runtime_error("Unsupported replay version"); }
+
+    Replay replay;
+    replay.seed  = read_u64(bytes.data() + 5);
+    replay.bytes = bytes;
+
+    // Walk the event stream once so playback never meets a malformed event, nor more ticks than a game can count
+    std::size_t   offset = REPLAY_HEADER_SIZE;
+    std::uint64_t ticks  = 0;
+    while (true) {
+        const auto event = read_varint(bytes, offset);
+        const auto code  = event & ((1u << REPLAY_CODE_BITS) - 1);
+
+        ticks += event >> REPLAY_CODE_BITS;
+        if (ticks > std::numeric_limits<unsigned int>::max()) { throw std::runtime_error("Replay tick count out of range"); }
+
+        if (code == REPLAY_END) { break; }
+        if (code > static_cast<unsigned int>(Action::Hold)) { throw std::runtime_error("Unknown replay event"); }
+    }
+    if (offset + 8 > bytes.size()) { throw std::runtime_error("Truncated replay"); }
+    replay.size = offset + 8 - REPLAY_HEADER_SIZE;
+
+    return replay;
+}
+
+ReplayResult Replay::play(Game &game) const {
+    using clock = std::chrono::steady_clock;
+
+    ReplayResult result;
+    const auto   started = clock::now();
+
+    game.init(seed);
+
+    std::size_t offset = REPLAY_HEADER_SIZE;
+    while (true) {
+        const auto event = read_varint(bytes, offset);
+        const auto code  = static_cast<unsigned int>(event & ((1u << REPLAY_CODE_BITS) - 1));
+
+        // Catch up with gravity first, the action happened after these ticks. Nothing is recorded past a game over,
+        // so an event there comes from a corrupt file: playback stops rather than tick a finished game
+        auto delta = event >> REPLAY_CODE_BITS;
+        for (; delta > 0 && !game.is_over(); --delta) { game.tick(); }
+        if (delta > 0 || (code != REPLAY_END && game.is_over())) {
+            result.overrun = true;
+            break;
+        }
+
+        if (code == REPLAY_END) {
+            result.expected_checksum = read_u64(bytes.data() + offset);
+            break;
+        }
+        game.apply(static_cast<Action>(code));
+        ++result.actions;
+    }
+
+    result.elapsed  = clock::now() - started;
+    result.ticks    = game.get_ticks();
+    result.checksum = game.get_checksum();
+    return result;
+}
+
+// --- Encoding ---
+
+void ReplayWriter::open(const std::string &path, const std::uint64_t seed) {
+    close();
+
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) { throw std::runtime_error("Cannot create replay " + path); }
+
+    failed = false;
+    buffer.clear();
+    buffer.reserve(BUFFER_SIZE + 2 * 10);
+    for (const auto byte : REPLAY_MAGIC) { buffer.push_back(static_cast<unsigned char>(byte)); }
+    buffer.push_back(REPLAY_VERSION);
+    write_u64(seed);
+
+    last_tick = 0;
+}
+void ReplayWriter::record(const Action action, const unsigned int tick) {
+    if (!is_open()) { return; }
+    write_event(static_cast<unsigned int>(action), tick);
+}
+bool ReplayWriter::finish(const Game &game) {
+    if (!is_open()) { return true; }
+
+    write_event(REPLAY_END, game.get_ticks());
+    write_u64(game.get_checksum());
+    return close();
+}
+bool ReplayWriter::close() {
+    if (!is_open()) { return true; }
+
+    flush();
+    const bool closed = std::fclose(file) == 0; // Also reports the errors of the writes still buffered by stdio
+    file              = nullptr;
+    return closed && !failed;
+}
+
+void ReplayWriter::write_event(const unsigned int code, const unsigned int tick) {
+    write_varint(static_cast<std::uint64_t>(tick - last_tick) << REPLAY_CODE_BITS | code);
+    last_tick = tick;
+
+    if (buffer.size() >= BUFFER_SIZE) { flush(); }
+}
+void ReplayWriter::write_varint(std::uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<unsigned char>(value));
+}
+void ReplayWriter::write_u64(const std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) { buffer.push_back(static_cast<unsigned char>(value >> (8 * i))); }
+}
+void ReplayWriter::flush() {
+    // Once a write fell short the file is truncated, later bytes would only hide it
+    if (!failed && std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) { failed = true; }
+    buffer.clear();
+}
@@ -0,0 +1,64 @@
+#include "scene.h"
+
+#include <cwchar>
+
+#include "configs/symbols.h"
+
+void Scene::draw(Renderer &renderer, const Game &game) {
+    renderer.set_color(Colors::Default);
+
+    const auto center = renderer.get_size() / 2;
+    const auto origin = Vec2(center.x - GAME_GRID_WIDTH / 2, center.y - GAME_GRID_HEIGHT / 2);
+
+    renderer.draw_border(Rect(origin + Vec2(-1, -1), Vec2(GAME_GRID_WIDTH * 2, GAME_GRID_HEIGHT) + Vec2(1, 1)));
+    renderer.draw_grid(game.get_grid(), origin);
+
+    const auto &held_shape         = game.get_held_shape();
+    const bool  held_shape_changed = held_shape.type != last_held_shape.type || held_shape.rotation != last_held_shape.rotation;
+    if (renderer.is_resized() || held_shape_changed) {
+        const auto held_window_origin = origin + Vec2(-GAME_HELD_WIDTH * 2 - 2, 0);
+
+        // Clear the held shape area
+        renderer.draw_box(Rect(held_window_origin, Vec2(GAME_HELD_WIDTH * 2, GAME_HELD_HEIGHT)), SYMBOL_EMPTY);
+
+        renderer.draw_border(Rect(held_window_origin + Vec2(-1, -1), Vec2(GAME_HELD_WIDTH * 2 + 1, GAME_HELD_HEIGHT + 1)));
+        renderer.draw_text(held_window_origin + Vec2(0, -1), L"HELD");
+
+        const auto shape_size       = held_shape.get_size() * Vec2(2, 1);
+        const auto held_window_size = Vec2(GAME_HELD_WIDTH * 2, GAME_HELD_HEIGHT);
+        renderer.draw_shape(held_shape, held_window_origin + (held_window_size - shape_size) / 2, false);
+
+        last_held_shape = held_shape;
+    }
+
+    const auto &current_shape = game.get_current_shape();
+    renderer.draw_shape(current_shape, origin + game.get_landing_position() * Vec2(2, 1), true);
+    renderer.draw_shape(current_shape, origin + current_shape.position * Vec2(2, 1), false);
+
+    // Metrics overlay under the held shape, right-aligned with it
+    const auto hud_origin = origin + Vec2(-GAME_HUD_WIDTH - 2, GAME_HELD_HEIGHT + 2);
+    if (hud_origin.x >= 0) {
+        if (show_metrics) { draw_metrics(renderer, hud_origin); }
+        else if (metrics_drawn) { renderer.draw_box(Rect(hud_origin, Vec2(GAME_HUD_WIDTH - 1, HUD_HEIGHT - 1)), SYMBOL_EMPTY); }
+        metrics_drawn = show_metrics;
+    }
+}
+void Scene::draw_metrics(Renderer &renderer, const Vec2 &hud_origin) const {
+    const auto &metrics = Metrics::local();
+    wchar_t     line[GAME_HUD_WIDTH + 1];
+
+    renderer.draw_text(hud_origin, L"us       p50   p99   max");
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        const auto  phase     = static_cast<Phase>(i);
+        const auto &histogram = metrics.get_phase(phase);
+        std::swprintf(line, GAME_HUD_WIDTH + 1, L"%-7s%5llu%6llu%6llu", Metrics::get_phase_name(phase), static_cast<unsigned long long>(histogram.percentile(50) / 1000),
+                      static_cast<unsigned long long>(histogram.percentile(99) / 1000), static_cast<unsigned long long>(histogram.get_max() / 1000));
+        renderer.draw_text(hud_origin + Vec2(0, 1 + i), line);
+    }
+
+    int row = PHASE_COUNT + 1;
+    for (const auto counter : {Counter::CollisionChecks, Counter::CellsDrawn, Counter::LinesCleared}) {
+        std::swprintf(line, GAME_HUD_WIDTH + 1, L"%-12s%12llu", Metrics::get_counter_name(counter), static_cast<unsigned long long>(metrics.get_counter(counter)));
+        renderer.draw_text(hud_origin + Vec2(0, row++), line);
+    }
+}
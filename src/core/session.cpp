@@ -0,0 +1,102 @@
+#include "session.h"
+
+#include <algorithm>
+
+#include "configs/input.h"
+
+Session::Session(const std::uint64_t seed) : seeds(seed) {
+    output.append(TelnetParser::GREETING);
+    output.append(ANSI_SCREEN_ENTER);
+    new_game();
+}
+
+void Session::receive(const std::string_view bytes) {
+    // Negotiation replies are queued at once, they never land inside a frame since frames are queued whole
+    telnet.feed(bytes, keys, output);
+
+    if (const auto window = telnet.get_window(); window != Vec2()) {
+        const Vec2 size(std::clamp(window.x, 1, SERVER_SCREEN_MAX_WIDTH), std::clamp(window.y, 1, SERVER_SCREEN_MAX_HEIGHT));
+        if (size != screen_size) {
+            screen_size = size;
+            renderer.set_size(size);
+            dirty = true;
+        }
+    }
+
+    // A sequence cut by the end of the bytes waits for the rest of it
+    std::size_t start = 0;
+    while (start < keys.size() && !closed) {
+        int        consumed = 0;
+        const auto key      = decode_ansi_key(keys.data() + start, static_cast<int>(keys.size() - start), consumed, false);
+        if (consumed == 0) { break; }
+
+        start += consumed;
+        if (key != KEY_CODE_NONE) { handle_key(key); }
+    }
+    keys.erase(0, start);
+
+    // Nobody types a sequence that long, drop it rather than keep it forever
+    if (keys.size() > ANSI_INPUT_BYTES) { keys.clear(); }
+}
+
+void Session::tick() {
+    if (closed) { return; }
+
+    if (game.tick()) { dirty = true; }
+    if (game.is_over()) { new_game(); }
+}
+
+bool Session::render() {
+    if (!dirty || closed) { return true; }
+
+    // Wait for the client to take the last frame, the next one then carries every change made meanwhile
+    if (output_start < output.size()) {
+        ++deferred;
+        return false;
+    }
+
+    renderer.update();
+    scene.draw(renderer, game);
+    renderer.refresh();
+
+    output.append(renderer.get_output());
+    dirty = false;
+    ++frames;
+    return true;
+}
+
+void Session::consume(const std::size_t count) {
+    output_start += count;
+    if (output_start >= output.size()) {
+        output.clear(); // Keeps the capacity for the next frames
+        output_start = 0;
+    }
+}
+
+bool Session::is_overflowing() const { return output.size() - output_start > SERVER_OUTPUT_LIMIT; }
+
+void Session::new_game() {
+    game.init(seeds());
+    ++games;
+    dirty = true;
+}
+
+void Session::handle_key(const int key) {
+    auto action = Action::Left;
+    switch (key) {
+        case INPUT_KEY_LEFT: action = Action::Left; break;
+        case INPUT_KEY_RIGHT: action = Action::Right; break;
+        case INPUT_KEY_DOWN: action = Action::SoftDrop; break;
+        case INPUT_KEY_UP: action = Action::Rotate; break;
+        case INPUT_KEY_PLACE: action = Action::HardDrop; break;
+        case INPUT_KEY_SWAP: action = Action::Hold; break;
+        case INPUT_KEY_QUIT:
+            closed = true;
+            output.append(ANSI_SCREEN_LEAVE);
+            return;
+        default: return;
+    }
+
+    if (game.apply(action)) { dirty = true; }
+    if (game.is_over()) { new_game(); }
+}
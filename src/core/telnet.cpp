@@ -0,0 +1,66 @@
+#include "telnet.h"
+
+void TelnetParser::feed(const std::string_view bytes, std::string &data, std::string &replies) {
+    for (const char c : bytes) {
+        const auto byte = static_cast<unsigned char>(c);
+        switch (state) {
+            case State::Data:
+                // NUL only pads a carriage return (CR NUL)
+                if (byte == TELNET_IAC) { state = State::Command; }
+                else if (byte != 0) { data += c; }
+                break;
+            case State::Command:
+                state = State::Data;
+                if (byte == TELNET_IAC) { data += c; }
+                else if (byte >= TELNET_WILL) {
+                    verb  = byte;
+                    state = State::Option;
+                } else if (byte == TELNET_SB) {
+                    sub_length = 0;
+                    state      = State::Subnegotiation;
+                }
+                break;
+            case State::Option:
+                negotiate(byte, replies);
+                state = State::Data;
+                break;
+            case State::Subnegotiation:
+                if (byte == TELNET_IAC) { state = State::SubCommand; }
+                else if (sub_length < TELNET_SUBNEGOTIATION_BYTES) { sub[sub_length++] = byte; }
+                break;
+            case State::SubCommand:
+                if (byte == TELNET_IAC) {
+                    if (sub_length < TELNET_SUBNEGOTIATION_BYTES) { sub[sub_length++] = byte; }
+                    state = State::Subnegotiation;
+                } else {
+                    // IAC SE, or a malformed command that ends the subnegotiation all the same
+                    subnegotiate();
+                    state = State::Data;
+                }
+                break;
+        }
+    }
+}
+
+void TelnetParser::negotiate(const unsigned char option, std::string &replies) const {
+    // Options the server asked for in its greeting are acknowledged by the client, answering would loop
+    const bool offered   = option == TELNET_OPTION_ECHO || option == TELNET_OPTION_SGA;
+    const bool requested = option == TELNET_OPTION_NAWS;
+
+    // Anything else stays disabled on both sides, and disabling what is disabled needs no answer
+    unsigned char answer = 0;
+    if (verb == TELNET_DO && !offered) { answer = TELNET_WONT; }
+    else if (verb == TELNET_WILL && !requested) { answer = TELNET_DONT; }
+    if (answer == 0) { return; }
+
+    replies += static_cast<char>(TELNET_IAC);
+    replies += static_cast<char>(answer);
+    replies += static_cast<char>(option);
+}
+
+void TelnetParser::subnegotiate() {
+    // NAWS: width and height as 16-bit big-endian numbers
+    if (sub_length == 5 && sub[0] == TELNET_OPTION_NAWS) {
+        window = Vec2(sub[1] << 8 | sub[2], sub[3] << 8 | sub[4]);
+    }
+}
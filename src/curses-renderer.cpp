@@ -0,0 +1,80 @@
+#include "curses-renderer.h"
+
+#include <clocale>
+#include <unistd.h>
+
+#include "configs/symbols.h"
+
+void CursesRenderer::init() {
+    setlocale(LC_ALL, ""); // Set locale to the user's environment
+    initscr();             // Initialize ncurses mode
+    cbreak();              // Disable line buffering, allowing input to be processed immediately
+    noecho();              // Disable echoing of typed characters
+    keypad(stdscr, TRUE);  // Enable special keys (like arrow keys)
+    nodelay(stdscr, TRUE); // Make getch() non-blocking
+    curs_set(0);           // Hide the cursor
+    start_color();         // Initialize color functionality
+    init_palette();        // Initialize the color palette
+}
+void CursesRenderer::terminate() {
+    endwin(); // End ncurses mode
+}
+
+bool CursesRenderer::wait_input(const std::chrono::milliseconds timeout) {
+    // Callers drain read_key() until KEY_CODE_NONE, so ncurses holds no buffered keys here
+    return poll_input(STDIN_FILENO, timeout);
+}
+int CursesRenderer::read_key() {
+    switch (const auto key = getch()) {
+        case ERR: return KEY_CODE_NONE;
+        case KEY_UP: return KEY_CODE_UP;
+        case KEY_DOWN: return KEY_CODE_DOWN;
+        case KEY_LEFT: return KEY_CODE_LEFT;
+        case KEY_RIGHT: return KEY_CODE_RIGHT;
+        case KEY_RESIZE: return KEY_CODE_RESIZE;
+        default: return key;
+    }
+}
+
+int CursesRenderer::present() {
+    const auto changed = frame.flush([this](const int x, const int y, const Cell *cells, const int n) { write_span(x, y, cells, n); });
+    ::refresh();
+    return changed;
+}
+
+void CursesRenderer::write_span(const int x, const int y, const Cell *cells, const int n) {
+    // Convert the run to terminal glyphs and write it with a single call
+    if (static_cast<int>(span_buffer.size()) < n) { span_buffer.resize(n); }
+    for (int i = 0; i < n; ++i) { set_glyph(span_buffer[i], cells[i]); }
+
+    mvadd_wchnstr(y, x, span_buffer.data(), n);
+}
+
+void CursesRenderer::set_glyph(cchar_t &glyph, const Cell &cell) {
+    if (cell.color >= 0 && cell.color < COLOR_PAIR_COUNT) {
+        for (int symbol = 0; symbol < SYMBOL_COUNT; ++symbol) {
+            if (SYMBOLS[symbol] == cell.glyph) {
+                glyph = glyphs[symbol][cell.color];
+                return;
+            }
+        }
+    }
+
+    // Text characters are not cached
+    const wchar_t text[] = {cell.glyph, L'\0'};
+    setcchar(&glyph, text, A_NORMAL, cell.color, nullptr);
+}
+
+void CursesRenderer::init_palette() {
+    // Both backends share the palette, ANSI color numbers are the ncurses COLOR_* values
+    for (short pair = 1; pair < COLOR_PAIR_COUNT; ++pair) { init_pair(pair, COLOR_PALETTE[pair].foreground, COLOR_PALETTE[pair].background); }
+
+    // Build the glyph of every symbol in every color pair once
+    for (int symbol = 0; symbol < SYMBOL_COUNT; ++symbol) {
+        const wchar_t text[] = {SYMBOLS[symbol], L'\0'};
+        for (short pair = 0; pair < COLOR_PAIR_COUNT; ++pair) { setcchar(&glyphs[symbol][pair], text, A_NORMAL, pair, nullptr); }
+    }
+    span_buffer.reserve(256);
+
+    attron(COLOR_PAIR(static_cast<short>(Colors::Default)));
+}
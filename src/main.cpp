@@ -1,9 +1,107 @@
-#include "game.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
 
-int main() {
-    Game game{};
+#include "ansi-renderer.h"
+#include "client.h"
+#include "metrics.h"
+#include "options.h"
+#include "replay.h"
 
-    game.init();      // Initialize the game
-    game.loop();      // Start the game loop
-    game.terminate(); // Clean up and exit the game
+// Play a replay file at full speed and check that it reproduces the recorded game
+static int play_replay(const char *path) {
+    try {
+        const auto replay = Replay::load(path);
+
+        Game       game;
+        const auto result  = replay.play(game);
+        const auto seconds = std::chrono::duration<double>(result.elapsed).count();
+
+        std::printf("seed %llu, %zu bytes, %lu actions, %u ticks, %u pieces, %u lines\n", static_cast<unsigned long long>(replay.get_seed()),
+                    replay.get_stream_size(), result.actions, result.ticks, game.get_pieces_placed(), game.get_lines_cleared());
+        std::printf("played in %.3f ms (%.0f actions/s)\n", seconds * 1000.0, seconds > 0 ? static_cast<double>(result.actions) / seconds : 0.0);
+        std::printf("checksum %016llx, expected %016llx: %s\n", static_cast<unsigned long long>(result.checksum),
+                    static_cast<unsigned long long>(result.expected_checksum), result.is_valid() ? "ok" : result.overrun ? "EVENTS PAST GAME OVER" : "MISMATCH");
+
+        return result.is_valid() ? 0 : 1;
+    } catch (const std::exception &error) {
+        std::fprintf(stderr, "%s\n", error.what());
+        return 2;
+    }
+}
+
+int main(const int argc, char **argv) {
+    bool          stats         = false;   // Print loop statistics on exit
+    bool          autoplay      = false;   // Let the bot play
+    bool          ansi          = false;   // Draw with escape sequences instead of ncurses
+    bool          headless      = false;   // Draw nothing, for bot runs at full speed
+    unsigned int  max_pieces    = 0;       // Piece limit of the game, the bot rarely tops out
+    const char    *record_path  = nullptr; // Replay file to record the game to
+    const char    *replay_path  = nullptr; // Replay file to play instead of a game
+    bool          seeded        = false;   // Flag set when a seed was given, a random one is drawn otherwise
+    std::uint64_t seed          = 0;       // Seed of the shape generator
+    const char    *metrics_path = nullptr; // File to dump the loop metrics to on exit
+    for (int i = 1; i < argc; ++i) {
+        bool valid = true;
+        if (std::strcmp(argv[i], "--stats") == 0) { stats = true; }
+        else if (std::strcmp(argv[i], "--bot") == 0) { autoplay = true; }
+        else if (std::strcmp(argv[i], "--ansi") == 0) { ansi = true; }
+        else if (std::strcmp(argv[i], "--headless") == 0) { headless = true; }
+        else if (std::strcmp(argv[i], "--max-pieces") == 0 && i + 1 < argc) { valid = parse_option(argv[++i], max_pieces); }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) { record_path = argv[++i]; }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) { replay_path = argv[++i]; }
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) { valid = seeded = parse_option(argv[++i], seed); }
+        else if (std::strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) { metrics_path = argv[++i]; }
+        else { valid = false; }
+
+        if (!valid) {
+            std::fprintf(stderr, "usage: %s [--stats] [--bot] [--ansi] [--headless] [--max-pieces N] [--record PATH] [--replay PATH] [--seed N] [--metrics PATH]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (replay_path != nullptr) { return play_replay(replay_path); }
+
+    Client client{};
+    client.autoplay   = autoplay;
+    client.max_pieces = max_pieces;
+    if (headless) { client.renderer = std::make_unique<NullRenderer>(); }
+    else if (ansi) { client.renderer = std::make_unique<AnsiRenderer>(); }
+
+    // Initialize the game
+    if (seeded) { client.init(seed); }
+    else { client.init(); }
+
+    if (record_path != nullptr) {
+        try {
+            client.record(record_path);
+        } catch (const std::exception &error) {
+            client.terminate();
+            std::fprintf(stderr, "%s\n", error.what());
+            return 2;
+        }
+    }
+
+    client.loop();                           // Start the game loop
+    const bool recorded = client.terminate(); // Clean up and exit the game
+    if (!recorded) { std::fprintf(stderr, "Failed to write the replay to %s\n", record_path); }
+
+    if (stats) {
+        const auto &latency = client.get_input_latency();
+        std::fprintf(stderr, "wakeups: %lu (%.1f/s)\n", client.get_wakeups(), client.get_wakeups_per_second());
+        std::fprintf(stderr, "key-to-refresh latency (us): count %llu, p50 %llu, p90 %llu, p99 %llu, max %llu\n",
+                     static_cast<unsigned long long>(latency.get_count()), static_cast<unsigned long long>(latency.percentile(50)),
+                     static_cast<unsigned long long>(latency.percentile(90)), static_cast<unsigned long long>(latency.percentile(99)),
+                     static_cast<unsigned long long>(latency.get_max()));
+    }
+
+    if (metrics_path != nullptr && !Metrics::local().dump(metrics_path)) {
+        std::fprintf(stderr, "Failed to write the metrics to %s\n", metrics_path);
+        return 2;
+    }
+
+    return recorded ? 0 : 2;
 }
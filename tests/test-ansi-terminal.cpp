@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <csignal>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+#include "ansi-terminal.h"
+#include "colors.h"
+#include "keys.h"
+
+// --- Helpers ---
+
+// Pipe whose ends are closed on destruction, the read end never blocks
+struct Pipe {
+    int ends[2] = {-1, -1};
+
+    Pipe() {
+        EXPECT_EQ(pipe(ends), 0);
+        fcntl(ends[0], F_SETFL, O_NONBLOCK);
+    }
+    ~Pipe() {
+        close(ends[0]);
+        close(ends[1]);
+    }
+
+    [[nodiscard]] std::string drain() const {
+        std::string bytes;
+        char        chunk[4096];
+        for (ssize_t count; (count = read(ends[0], chunk, sizeof(chunk))) > 0;) { bytes.append(chunk, count); }
+        return bytes;
+    }
+};
+
+static Cell cell(const wchar_t glyph, const Colors color) { return Cell{glyph, static_cast<short>(color)}; }
+
+// --- Frame Tests ---
+
+TEST(ansi_terminal, FrameIsOneWrite) {
+    Pipe         output;
+    AnsiTerminal terminal(STDIN_FILENO, output.ends[1]);
+
+    const Cell row[] = {cell(L'a', Colors::Red), cell(L'b', Colors::Red), cell(L'c', Colors::Default)};
+    terminal.begin_frame();
+    terminal.write_span(2, 1, row, 3);
+    terminal.write_span(0, 3, row, 1);
+    ASSERT_TRUE(terminal.end_frame());
+
+    EXPECT_EQ(terminal.get_writes(), 1u);
+    EXPECT_EQ(output.drain(), "\x1b[?2026h"
+                              "\x1b[2;3H\x1b[0;31;40mab\x1b[0;37;40mc"
+                              "\x1b[4;1H\x1b[0;31;40ma"
+                              "\x1b[?2026l");
+}
+
+TEST(ansi_terminal, SkipsRedundantSequences) {
+    Pipe         output;
+    AnsiTerminal terminal(STDIN_FILENO, output.ends[1]);
+    terminal.set_synchronized(false);
+
+    // A run starting where the last one ended needs no cursor move, an unchanged color no SGR
+    const Cell left[]  = {cell(L'x', Colors::Blue)};
+    const Cell right[] = {cell(L'y', Colors::Blue)};
+    terminal.begin_frame();
+    terminal.write_span(0, 0, left, 1);
+    terminal.write_span(1, 0, right, 1);
+    ASSERT_TRUE(terminal.end_frame());
+
+    EXPECT_EQ(output.drain(), "\x1b[1;1H\x1b[0;34;40mxy");
+}
+
+TEST(ansi_terminal, EncodesUtf8) {
+    Pipe         output;
+    AnsiTerminal terminal(STDIN_FILENO, output.ends[1]);
+    terminal.set_synchronized(false);
+
+    const Cell cells[] = {Cell{L'█', 0}, Cell{L'é', 0}, Cell{L'A', 0}};
+    terminal.begin_frame();
+    terminal.write_span(0, 0, cells, 3);
+    ASSERT_TRUE(terminal.end_frame());
+
+    EXPECT_EQ(output.drain(), "\x1b[1;1H\x1b[0m\xe2\x96\x88\xc3\xa9" "A");
+}
+
+TEST(ansi_terminal, EmptyFrameIsNotWritten) {
+    Pipe         output;
+    AnsiTerminal terminal(STDIN_FILENO, output.ends[1]);
+
+    terminal.begin_frame();
+    ASSERT_TRUE(terminal.end_frame());
+
+    EXPECT_EQ(terminal.get_writes(), 0u);
+    EXPECT_EQ(output.drain(), "");
+}
+
+TEST(ansi_terminal, FullFrameFitsThePreallocatedBuffer) {
+    Pipe         output;
+    AnsiTerminal terminal(STDIN_FILENO, output.ends[1]);
+    terminal.resize(Vec2(40, 10));
+
+    // Worst case: every cell needs a cursor move, a color change and a 3-byte glyph
+    terminal.begin_frame();
+    for (int y = 0; y < 10; ++y) {
+        for (int x = 0; x < 40; x += 2) {
+            const Cell block = cell(L'█', static_cast<Colors>(1 + (x + y) % (COLOR_PAIR_COUNT - 1)));
+            terminal.write_span(x, y, &block, 1);
+        }
+    }
+    EXPECT_LE(terminal.get_frame().size(), static_cast<std::size_t>(ANSI_FRAME_BYTES + 40 * 10 * ANSI_CELL_BYTES));
+    ASSERT_TRUE(terminal.end_frame());
+    EXPECT_EQ(output.drain().size(), terminal.get_frame().size());
+}
+
+// --- Input Tests ---
+
+TEST(ansi_terminal, DecodesKeys) {
+    Pipe         input;
+    AnsiTerminal terminal(input.ends[0], STDOUT_FILENO);
+
+    const std::string bytes = "a\x1b[A\x1b[B\x1bOC\x1b[D\x1b[1;5Hq ";
+    ASSERT_EQ(write(input.ends[1], bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+
+    EXPECT_EQ(terminal.read_key(), 'a');
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_UP);
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_DOWN);
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_RIGHT);
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_LEFT);
+    EXPECT_EQ(terminal.read_key(), 'q'); // Unknown sequences are skipped
+    EXPECT_TRUE(terminal.has_pending_input());
+    EXPECT_EQ(terminal.read_key(), ' ');
+    EXPECT_FALSE(terminal.has_pending_input());
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_NONE);
+}
+
+TEST(ansi_terminal, LoneEscape) {
+    Pipe         input;
+    AnsiTerminal terminal(input.ends[0], STDOUT_FILENO);
+
+    ASSERT_EQ(write(input.ends[1], "\x1b", 1), 1);
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_ESCAPE);
+    EXPECT_EQ(terminal.read_key(), KEY_CODE_NONE);
+}
+
+// --- Signal Tests ---
+
+TEST(ansi_terminal, ExitSignalLeavesTheScreen) {
+    Pipe output;
+
+    // The child dies of the signal, after putting the screen back the way it found it
+    EXPECT_EXIT(
+        {
+            AnsiTerminal terminal(output.ends[0], output.ends[1]);
+            terminal.open();
+            std::raise(SIGTERM);
+        },
+        testing::KilledBySignal(SIGTERM), "");
+
+    const auto bytes = output.drain();
+    ASSERT_GE(bytes.size(), ANSI_SCREEN_LEAVE.size());
+    EXPECT_EQ(bytes.substr(bytes.size() - ANSI_SCREEN_LEAVE.size()), ANSI_SCREEN_LEAVE);
+}
+
+TEST(ansi_terminal, CloseRestoresExitSignals) {
+    Pipe         output;
+    AnsiTerminal terminal(output.ends[0], output.ends[1]);
+
+    terminal.open();
+    struct sigaction action = {};
+    sigaction(SIGINT, nullptr, &action);
+    EXPECT_NE(action.sa_handler, SIG_DFL);
+
+    terminal.close();
+    sigaction(SIGINT, nullptr, &action);
+    EXPECT_EQ(action.sa_handler, SIG_DFL);
+}
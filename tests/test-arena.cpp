@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "arena.h"
+
+// --- Allocation Tests ---
+
+TEST(arena, AllocatesAligned) {
+    Arena arena(256);
+
+    for (const std::size_t alignment : {1u, 2u, 8u, 16u, 64u}) {
+        const auto pointer = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % alignment, 0u) << "alignment " << alignment;
+    }
+}
+
+TEST(arena, GrowsPastBlocks) {
+    Arena arena(128);
+
+    EXPECT_NE(arena.allocate(100), nullptr);
+    EXPECT_NE(arena.allocate(100), nullptr);
+    EXPECT_EQ(arena.get_blocks(), 2u);
+
+    // Larger than a block
+    const auto large = static_cast<char *>(arena.allocate(1000));
+    std::fill_n(large, 1000, 'x');
+    EXPECT_EQ(arena.get_blocks(), 3u);
+    EXPECT_GE(arena.get_capacity(), 1256u);
+}
+
+TEST(arena, ResetReusesBlocks) {
+    Arena arena(1024);
+
+    const auto first = arena.allocate(64);
+    EXPECT_NE(arena.allocate(2000), nullptr);
+    const auto blocks = arena.get_blocks();
+
+    arena.reset();
+    EXPECT_EQ(arena.get_used(), 0u);
+    EXPECT_EQ(arena.allocate(64), first);
+
+    EXPECT_NE(arena.allocate(2000), nullptr);
+    EXPECT_EQ(arena.get_blocks(), blocks);
+}
+
+TEST(arena, ScopeRewinds) {
+    Arena arena(1024);
+    EXPECT_NE(arena.allocate(10), nullptr);
+    const auto used = arena.get_used();
+
+    {
+        ArenaScope scope(arena);
+        EXPECT_NE(arena.allocate(500), nullptr);
+        EXPECT_NE(arena.allocate(5000), nullptr);
+        EXPECT_GT(arena.get_used(), used);
+    }
+    EXPECT_EQ(arena.get_used(), used);
+}
+
+TEST(arena, BacksPmrContainers) {
+    Arena arena(256);
+
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 1000; ++i) { values.push_back(i); }
+
+    EXPECT_EQ(values.size(), 1000u);
+    EXPECT_EQ(values[999], 999);
+    EXPECT_GE(arena.get_used(), 1000 * sizeof(int));
+}
+
+// --- Thread Tests ---
+
+TEST(arena, LocalPerThread) {
+    Arena *main_arena  = &Arena::local();
+    Arena *other_arena = nullptr;
+    std::thread([&other_arena] { other_arena = &Arena::local(); }).join();
+
+    EXPECT_EQ(&Arena::local(), main_arena);
+    EXPECT_NE(other_arena, main_arena);
+}
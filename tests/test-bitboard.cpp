@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "bitboard.h"
+
+// --- Helpers ---
+
+static bool byte_grid_intersects(const GameGrid &grid, const BoardMatrix<unsigned char> &shape_grid, const Vec2 &pos) {
+    for (int y = 0; y < shape_grid.get_height(); ++y) {
+        for (int x = 0; x < shape_grid.get_width(); ++x) {
+            if (shape_grid(x, y) != 0 && grid(pos.x + x, pos.y + y) != 0) { return true; }
+        }
+    }
+    return false;
+}
+
+// --- Main Tests ---
+
+TEST(bitboard, Initialization) {
+    const Bitboard board;
+
+    for (int y = 0; y < Bitboard::HEIGHT; ++y) { EXPECT_TRUE(board.is_row_empty(y)); }
+}
+
+TEST(bitboard, SetAndReset) {
+    Bitboard board;
+    board.set(3, 5);
+
+    EXPECT_TRUE(board.is_filled(3, 5));
+    EXPECT_FALSE(board.is_filled(4, 5));
+    EXPECT_FALSE(board.is_filled(3, 4));
+
+    board.reset(3, 5);
+    EXPECT_FALSE(board.is_filled(3, 5));
+}
+
+TEST(bitboard, FullRow) {
+    Bitboard board;
+    for (int x = 0; x < Bitboard::WIDTH - 1; ++x) { board.set(x, 7); }
+    EXPECT_FALSE(board.is_row_full(7));
+
+    board.set(Bitboard::WIDTH - 1, 7);
+    EXPECT_TRUE(board.is_row_full(7));
+}
+
+TEST(bitboard, FromGrid) {
+    GameGrid grid;
+    grid(0, 0) = 1;
+    grid(9, 19) = 7;
+
+    const auto board = Bitboard::from_grid(grid);
+
+    EXPECT_TRUE(board.is_filled(0, 0));
+    EXPECT_TRUE(board.is_filled(9, 19));
+    EXPECT_FALSE(board.is_filled(1, 0));
+}
+
+TEST(bitboard, ColumnHeights) {
+    Bitboard board;
+    board.set(0, Bitboard::HEIGHT - 1);
+    board.set(2, 5);
+    board.set(2, 10);
+
+    const auto heights = board.column_heights();
+
+    EXPECT_EQ(heights[0], 1);
+    EXPECT_EQ(heights[1], 0);
+    EXPECT_EQ(heights[2], Bitboard::HEIGHT - 5);
+}
+
+// --- Shape Mask Tests ---
+
+TEST(bitboard, ShapeMask) {
+    BoardMatrix<unsigned char> shape(3, 2);
+    shape(0, 0) = 6;
+    shape(1, 0) = 6;
+    shape(2, 0) = 6;
+    shape(1, 1) = 6;
+
+    const auto mask = Bitboard::mask_of(shape);
+
+    EXPECT_EQ(mask[0], 0b111u);
+    EXPECT_EQ(mask[1], 0b010u);
+    EXPECT_EQ(mask[2], 0u);
+}
+
+TEST(bitboard, PlaceAndIntersect) {
+    BoardMatrix<unsigned char> shape(2, 2, 4);
+    const auto                 mask = Bitboard::mask_of(shape);
+
+    Bitboard board;
+    board.place(mask, 2, Vec2(4, 10));
+
+    EXPECT_TRUE(board.is_filled(4, 10));
+    EXPECT_TRUE(board.is_filled(5, 11));
+    EXPECT_TRUE(board.intersects(mask, 2, Vec2(5, 11)));
+    EXPECT_FALSE(board.intersects(mask, 2, Vec2(6, 10)));
+    EXPECT_FALSE(board.intersects(mask, 2, Vec2(4, 12)));
+}
+
+TEST(bitboard, MatchesByteGrid) {
+    std::mt19937                       rng(1234);
+    std::uniform_int_distribution<int> cell(0, 2);
+
+    BoardMatrix<unsigned char> shape(3, 2);
+    shape(0, 0) = 5;
+    shape(1, 0) = 5;
+    shape(1, 1) = 5;
+    shape(2, 1) = 5;
+    const auto mask = Bitboard::mask_of(shape);
+
+    for (int round = 0; round < 32; ++round) {
+        GameGrid grid;
+        for (int y = 0; y < GAME_GRID_HEIGHT; ++y) { for (int x = 0; x < GAME_GRID_WIDTH; ++x) { grid(x, y) = cell(rng) == 0 ? 1 : 0; } }
+
+        const auto board = Bitboard::from_grid(grid);
+        for (int y = 0; y + shape.get_height() <= GAME_GRID_HEIGHT; ++y) {
+            for (int x = 0; x + shape.get_width() <= GAME_GRID_WIDTH; ++x) {
+                EXPECT_EQ(board.intersects(mask, shape.get_height(), Vec2(x, y)), byte_grid_intersects(grid, shape, Vec2(x, y)));
+            }
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <random>
+
+#include "board-batch.h"
+
+// --- Helpers ---
+
+// Features of one board computed cell by cell, the reference of every kernel
+struct ReferenceFeatures {
+    int height = 0, holes = 0, bumpiness = 0, wells = 0, transitions = 0;
+};
+
+static ReferenceFeatures reference_features(const Bitboard &board) {
+    ReferenceFeatures features;
+
+    int heights[Bitboard::WIDTH] = {};
+    for (int x = 0; x < Bitboard::WIDTH; ++x) {
+        for (int y = 0; y < Bitboard::HEIGHT; ++y) {
+            if (board.is_filled(x, y)) {
+                heights[x] = Bitboard::HEIGHT - y;
+                break;
+            }
+        }
+        for (int y = Bitboard::HEIGHT - heights[x]; y < Bitboard::HEIGHT; ++y) { features.holes += !board.is_filled(x, y); }
+        features.height += heights[x];
+    }
+    for (int x = 0; x < Bitboard::WIDTH; ++x) {
+        if (x > 0) { features.bumpiness += std::abs(heights[x] - heights[x - 1]); }
+        const auto left  = x > 0 ? heights[x - 1] : Bitboard::HEIGHT;
+        const auto right = x + 1 < Bitboard::WIDTH ? heights[x + 1] : Bitboard::HEIGHT;
+        features.wells += std::max(0, std::min(left, right) - heights[x]);
+    }
+    for (int y = 0; y < Bitboard::HEIGHT; ++y) {
+        bool previous = true; // Left wall
+        for (int x = 0; x <= Bitboard::WIDTH; ++x) {
+            const bool filled = x == Bitboard::WIDTH || board.is_filled(x, y); // Right wall
+            features.transitions += filled != previous;
+            previous = filled;
+        }
+    }
+
+    return features;
+}
+
+static Bitboard random_board(std::mt19937 &rng) {
+    Bitboard board;
+    const auto top     = static_cast<int>(rng() % Bitboard::HEIGHT);
+    const auto density = 1 + rng() % 3;
+    for (int y = top; y < Bitboard::HEIGHT; ++y) {
+        for (int x = 0; x < Bitboard::WIDTH; ++x) {
+            if (rng() % 4 < density) { board.set(x, y); }
+        }
+    }
+    return board;
+}
+
+// --- Kernel Tests ---
+
+class board_batch : public testing::TestWithParam<BatchKernel> {};
+
+TEST_P(board_batch, MatchesReference) {
+    if (!BoardBatch::is_supported(GetParam())) { GTEST_SKIP() << BoardBatch::get_kernel_name(GetParam()) << " is not supported here"; }
+
+    std::mt19937 rng(99);
+    for (int round = 0; round < 50; ++round) {
+        // Partial batches too, so every lane count is covered
+        const auto size = 1 + round % BOARD_BATCH_SIZE;
+
+        BoardBatch batch;
+        Bitboard   boards[BOARD_BATCH_SIZE];
+        for (int i = 0; i < size; ++i) {
+            boards[i] = random_board(rng);
+            EXPECT_EQ(batch.add(boards[i], i % 5), i);
+        }
+
+        BoardBatchFeatures features;
+        batch.compute(features, GetParam());
+
+        for (int i = 0; i < size; ++i) {
+            const auto expected = reference_features(boards[i]);
+            EXPECT_EQ(features.height[i], expected.height);
+            EXPECT_EQ(features.holes[i], expected.holes);
+            EXPECT_EQ(features.bumpiness[i], expected.bumpiness);
+            EXPECT_EQ(features.wells[i], expected.wells);
+            EXPECT_EQ(features.transitions[i], expected.transitions);
+            EXPECT_EQ(features.lines[i], i % 5);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(kernels, board_batch, testing::Values(BatchKernel::Scalar, BatchKernel::Sse2, BatchKernel::Avx2),
+                         [](const testing::TestParamInfo<BatchKernel> &info) { return std::string(BoardBatch::get_kernel_name(info.param)); });
+
+// --- Batch Tests ---
+
+TEST(board_batch_size, AddAndClear) {
+    BoardBatch batch;
+    EXPECT_TRUE(batch.is_empty());
+
+    for (int i = 0; i < BOARD_BATCH_SIZE; ++i) { batch.add(Bitboard(), 0); }
+    EXPECT_TRUE(batch.is_full());
+
+    batch.clear();
+    EXPECT_TRUE(batch.is_empty());
+    EXPECT_EQ(batch.size(), 0);
+}
+
+TEST(board_batch_size, EmptyBoard) {
+    BoardBatch batch;
+    batch.add(Bitboard(), 0);
+
+    BoardBatchFeatures features;
+    batch.compute(features);
+
+    EXPECT_EQ(features.height[0], 0);
+    EXPECT_EQ(features.holes[0], 0);
+    EXPECT_EQ(features.wells[0], 0);
+    EXPECT_EQ(features.transitions[0], 2 * Bitboard::HEIGHT);
+}
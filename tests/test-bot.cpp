@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <tuple>
+
+#include "bot.h"
+
+// --- Helpers ---
+
+// Best score of every lock position reached by playing moves on copies of the game, the reference for the bot search
+static double brute_force_best_score(const Game &game, const Bot &bot) {
+    auto best = -std::numeric_limits<double>::infinity();
+    for (const bool hold : {false, true}) {
+        auto start = game;
+        if (hold && (!start.apply(Action::Hold) || start.is_over())) { continue; }
+
+        // Breadth-first over the positions of the current shape, each played on its own copy
+        std::set<std::tuple<int, int, int>> seen;
+        std::vector<Game>                   queue = {start};
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            const auto &shape = queue[i].get_current_shape();
+            if (!seen.emplace(shape.rotation, shape.position.x, shape.position.y).second) { continue; }
+
+            auto dropped = queue[i];
+            dropped.apply(Action::HardDrop);
+            best = std::max(best, bot.evaluate(dropped.get_occupancy(), dropped.get_last_clear().count));
+
+            for (const auto action : {Action::Left, Action::Right, Action::SoftDrop, Action::Rotate}) {
+                auto moved = queue[i];
+                if (moved.apply(action)) { queue.push_back(std::move(moved)); }
+            }
+        }
+    }
+    return best;
+}
+
+// --- Evaluation Tests ---
+
+TEST(bot, EvaluatePenalizesHoles) {
+    const Bot bot;
+
+    Bitboard flat;
+    for (int x = 0; x < Bitboard::WIDTH - 1; ++x) { flat.set(x, Bitboard::HEIGHT - 1); }
+
+    auto holed = flat;
+    holed.set(Bitboard::WIDTH - 1, Bitboard::HEIGHT - 2);
+
+    EXPECT_GT(bot.evaluate(flat, 0), bot.evaluate(holed, 0));
+    EXPECT_GT(bot.evaluate(Bitboard(), 1), bot.evaluate(Bitboard(), 0));
+}
+
+// --- Search Tests ---
+
+TEST(bot, MatchesBruteForce) {
+    for (std::uint64_t seed = 0; seed < 20; ++seed) {
+        Game game;
+        game.init(seed);
+
+        Bot bot;
+        for (int piece = 0; piece < 10 && !game.is_over(); ++piece) {
+            const auto move = bot.find_move(game);
+            ASSERT_TRUE(move.is_valid());
+            EXPECT_DOUBLE_EQ(move.score, brute_force_best_score(game, bot));
+
+            bot.play(game);
+        }
+    }
+}
+
+TEST(bot, ActionsReachThePlacement) {
+    Game game;
+    game.init(5);
+
+    Bot bot;
+    for (int piece = 0; piece < 100 && !game.is_over(); ++piece) {
+        const auto move = bot.find_move(game);
+        ASSERT_TRUE(move.is_valid());
+
+        move.for_each_action([&game, &move](const Action action) {
+            if (action == Action::HardDrop) { EXPECT_EQ(game.get_landing_position(), move.position); }
+            EXPECT_TRUE(game.apply(action));
+        });
+    }
+}
+
+TEST(bot, SurvivesLongGames) {
+    Game game;
+    game.init(2024);
+
+    Bot bot;
+    for (int piece = 0; piece < 1000; ++piece) { ASSERT_TRUE(bot.play(game)) << "game over after " << piece << " pieces"; }
+
+    EXPECT_FALSE(game.is_over());
+    EXPECT_GT(game.get_lines_cleared(), 350u);
+    EXPECT_GT(bot.get_evaluated(), 1000u * 9);
+}
+
+// --- Lookahead Tests ---
+
+TEST(bot, LookaheadTableKeepsTheSameMoves) {
+    Game with_table, without_table;
+    with_table.init(77);
+    without_table.init(77);
+
+    TranspositionTable table(12);
+    Bot                cached(BotWeights(), true, &table);
+    Bot                uncached(BotWeights(), true);
+    for (int piece = 0; piece < 60; ++piece) {
+        const auto move = cached.find_move(with_table);
+        const auto same = uncached.find_move(without_table);
+        ASSERT_EQ(move.position, same.position) << "piece " << piece;
+        ASSERT_EQ(move.hold, same.hold) << "piece " << piece;
+
+        ASSERT_TRUE(cached.play(with_table));
+        ASSERT_TRUE(uncached.play(without_table));
+    }
+
+    EXPECT_EQ(with_table.get_hash(), without_table.get_hash());
+    EXPECT_GT(table.get_hits(), 0u);
+}
+
+TEST(bot, LookaheadSurvives) {
+    Game game;
+    game.init(2024);
+
+    TranspositionTable table(12);
+    Bot                bot(BotWeights(), true, &table);
+    for (int piece = 0; piece < 200; ++piece) { ASSERT_TRUE(bot.play(game)) << "game over after " << piece << " pieces"; }
+    EXPECT_GT(game.get_lines_cleared(), 60u);
+}
+
+TEST(bot, NoMoveWhenOver) {
+    Game game;
+    game.init(1);
+    while (!game.is_over()) { game.apply(Action::HardDrop); }
+
+    Bot bot;
+    EXPECT_FALSE(bot.find_move(game).is_valid());
+    EXPECT_FALSE(bot.play(game));
+}
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "broadcast.h"
+
+// --- Helpers ---
+
+// Send everything queued for a viewer, returns the bytes sent
+static std::string drain(Spectator &spectator) {
+    std::string sent;
+    iovec       vectors[SPECTATOR_IOVECS];
+    while (spectator.has_output()) {
+        const int   count = spectator.gather(vectors, SPECTATOR_IOVECS);
+        std::size_t bytes = 0;
+        for (int i = 0; i < count; ++i) {
+            sent.append(static_cast<const char *>(vectors[i].iov_base), vectors[i].iov_len);
+            bytes += vectors[i].iov_len;
+        }
+        spectator.consume(bytes);
+    }
+    return sent;
+}
+
+static Game make_game() {
+    Game game;
+    game.init(42);
+    return game;
+}
+
+// --- Broadcast Tests ---
+
+TEST(broadcast, PublishesOnlyChanges) {
+    auto      game = make_game();
+    Broadcast broadcast;
+
+    const auto first = broadcast.publish(game);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->sequence, 1u);
+    EXPECT_FALSE(first->keyframe);
+
+    // Nothing moved: no frame at all
+    EXPECT_EQ(broadcast.publish(game), nullptr);
+    EXPECT_EQ(broadcast.get_sequence(), 1u);
+
+    ASSERT_TRUE(game.apply(Action::Left));
+    const auto second = broadcast.publish(game);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->sequence, 2u);
+    EXPECT_LT(second->bytes.size(), first->bytes.size());
+}
+
+TEST(broadcast, KeyframeIsEncodedOncePerFrame) {
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    const auto keyframe = broadcast.get_keyframe();
+    EXPECT_TRUE(keyframe->keyframe);
+    EXPECT_EQ(keyframe->sequence, 1u);
+    EXPECT_NE(keyframe->bytes.find("\x1b[2J"), std::string::npos);
+    EXPECT_EQ(broadcast.get_keyframe(), keyframe);
+    EXPECT_EQ(broadcast.get_keyframes(), 1u);
+
+    game.apply(Action::Left);
+    broadcast.publish(game);
+    EXPECT_NE(broadcast.get_keyframe(), keyframe);
+    EXPECT_EQ(broadcast.get_keyframes(), 2u);
+}
+
+// --- Spectator Tests ---
+
+TEST(broadcast, ViewersShareTheSameBytes) {
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    Spectator first;
+    Spectator second;
+    first.watch(broadcast);
+    second.watch(broadcast);
+    drain(first);
+    drain(second);
+
+    game.apply(Action::Left);
+    const auto frame = broadcast.publish(game);
+    ASSERT_TRUE(first.offer(frame));
+    ASSERT_TRUE(second.offer(frame));
+
+    // Both point into the one encoded frame, nothing was copied per viewer
+    iovec a[SPECTATOR_IOVECS];
+    iovec b[SPECTATOR_IOVECS];
+    ASSERT_EQ(first.gather(a, SPECTATOR_IOVECS), 1);
+    ASSERT_EQ(second.gather(b, SPECTATOR_IOVECS), 1);
+    EXPECT_EQ(a[0].iov_base, frame->bytes.data());
+    EXPECT_EQ(b[0].iov_base, frame->bytes.data());
+    EXPECT_EQ(frame.use_count(), 3);
+}
+
+TEST(broadcast, GreetsThenStartsFromAKeyframe) {
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    Spectator spectator;
+    spectator.watch(broadcast);
+    const auto sent = drain(spectator);
+
+    const auto greeting = std::string(TelnetParser::GREETING) + std::string(ANSI_SCREEN_ENTER);
+    EXPECT_EQ(sent, greeting + broadcast.get_keyframe()->bytes);
+    EXPECT_EQ(spectator.get_keyframes(), 1u);
+
+    // A frame already on the screen through the keyframe is not sent again
+    EXPECT_TRUE(spectator.offer(broadcast.get_keyframe()));
+    EXPECT_FALSE(spectator.has_output());
+}
+
+TEST(broadcast, SlowViewerSkipsToAKeyframe) {
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    Spectator spectator(4096);
+    spectator.watch(broadcast);
+    drain(spectator);
+
+    // The viewer reads nothing while the game goes on
+    iovec vectors[SPECTATOR_IOVECS];
+    for (int i = 0; i < 200 && spectator.get_keyframes() == 1; ++i) {
+        game.apply(i % 2 == 0 ? Action::Left : Action::Right);
+        ASSERT_TRUE(spectator.offer(broadcast.publish(game)));
+    }
+    ASSERT_EQ(spectator.get_keyframes(), 2u);
+    EXPECT_GT(spectator.get_skipped_frames(), 0u);
+
+    // What is queued is the whole screen as it is now, and nothing else
+    ASSERT_EQ(spectator.gather(vectors, SPECTATOR_IOVECS), 1);
+    EXPECT_EQ(vectors[0].iov_base, broadcast.get_keyframe()->bytes.data());
+    EXPECT_EQ(spectator.get_queued_bytes(), broadcast.get_keyframe()->bytes.size());
+}
+
+TEST(broadcast, FrameBeingSentIsKept) {
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    Spectator spectator(4096);
+    spectator.watch(broadcast);
+    drain(spectator);
+
+    game.apply(Action::Left);
+    const auto started = broadcast.publish(game);
+    ASSERT_TRUE(spectator.offer(started));
+    spectator.consume(1);
+
+    for (int i = 0; i < 200 && spectator.get_keyframes() == 1; ++i) {
+        game.apply(i % 2 == 0 ? Action::Right : Action::Left);
+        ASSERT_TRUE(spectator.offer(broadcast.publish(game)));
+    }
+    ASSERT_EQ(spectator.get_keyframes(), 2u);
+
+    // The rest of the started frame, then the keyframe
+    iovec vectors[SPECTATOR_IOVECS];
+    ASSERT_EQ(spectator.gather(vectors, SPECTATOR_IOVECS), 2);
+    EXPECT_EQ(vectors[0].iov_base, started->bytes.data() + 1);
+    EXPECT_EQ(vectors[0].iov_len, started->bytes.size() - 1);
+    EXPECT_EQ(vectors[1].iov_base, broadcast.get_keyframe()->bytes.data());
+}
+
+TEST(broadcast, HopelessViewerIsDropped) {
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+
+    Spectator spectator(4096);
+    spectator.watch(broadcast);
+    drain(spectator);
+
+    // Behind again with the keyframe still queued: the viewer has to go
+    bool kept = true;
+    for (int i = 0; i < 400 && kept; ++i) {
+        game.apply(i % 2 == 0 ? Action::Left : Action::Right);
+        kept = spectator.offer(broadcast.publish(game));
+    }
+    EXPECT_FALSE(kept);
+    EXPECT_EQ(spectator.get_keyframes(), 2u);
+}
+
+TEST(broadcast, ViewerQuits) {
+    Spectator spectator;
+    drain(spectator);
+
+    spectator.receive("\xff\xfb\x1fq");
+    EXPECT_TRUE(spectator.is_closed());
+    EXPECT_EQ(drain(spectator), ANSI_SCREEN_LEAVE);
+}
+
+TEST(broadcast, QuitViewerIsNotFeaturedAgain) {
+    Spectator spectator;
+    drain(spectator);
+
+    // The featured player leaves while the farewell is still queued
+    spectator.receive("q");
+    auto      game = make_game();
+    Broadcast broadcast;
+    broadcast.publish(game);
+    spectator.watch(broadcast);
+
+    EXPECT_FALSE(spectator.is_watching());
+    EXPECT_EQ(drain(spectator), ANSI_SCREEN_LEAVE);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "framebuffer.h"
+
+// --- Helpers ---
+
+struct Span {
+    int x, y, count;
+};
+
+static std::vector<Span> flush_spans(FrameBuffer &frame) {
+    std::vector<Span> spans;
+    frame.flush([&](const int x, const int y, const Cell *, const int count) { spans.push_back(Span{x, y, count}); });
+    return spans;
+}
+
+// --- Main Tests ---
+
+TEST(framebuffer, Initialization) {
+    const FrameBuffer frame(Vec2(4, 3));
+
+    EXPECT_EQ(frame.get_size(), Vec2(4, 3));
+    EXPECT_TRUE(frame.contains(3, 2));
+    EXPECT_FALSE(frame.contains(4, 0));
+    EXPECT_FALSE(frame.contains(0, -1));
+}
+
+TEST(framebuffer, FirstFlushRedrawsEverything) {
+    FrameBuffer frame(Vec2(4, 3));
+
+    const auto spans = flush_spans(frame);
+
+    ASSERT_EQ(spans.size(), 3u);
+    EXPECT_EQ(spans[0].count, 4);
+    EXPECT_EQ(frame.get_changed_cells(), 12);
+}
+
+TEST(framebuffer, UnchangedFrameEmitsNothing) {
+    FrameBuffer frame(Vec2(4, 3));
+    flush_spans(frame);
+
+    frame(1, 1) = Cell{L' ', 0}; // Same as displayed
+    EXPECT_TRUE(flush_spans(frame).empty());
+    EXPECT_EQ(frame.get_changed_cells(), 0);
+}
+
+TEST(framebuffer, ChangedRuns) {
+    FrameBuffer frame(Vec2(8, 2));
+    flush_spans(frame);
+
+    frame(1, 0) = Cell{L'#', 1};
+    frame(2, 0) = Cell{L'#', 1};
+    frame(5, 0) = Cell{L' ', 2}; // Only the color changes
+    frame(7, 1) = Cell{L'x', 0};
+
+    const auto spans = flush_spans(frame);
+
+    ASSERT_EQ(spans.size(), 3u);
+    EXPECT_EQ(spans[0].x, 1);
+    EXPECT_EQ(spans[0].count, 2);
+    EXPECT_EQ(spans[1].x, 5);
+    EXPECT_EQ(spans[1].count, 1);
+    EXPECT_EQ(spans[2].y, 1);
+    EXPECT_EQ(spans[2].x, 7);
+    EXPECT_EQ(frame.get_changed_cells(), 4);
+}
+
+TEST(framebuffer, Invalidate) {
+    FrameBuffer frame(Vec2(2, 2));
+    flush_spans(frame);
+
+    frame.invalidate();
+    flush_spans(frame);
+
+    EXPECT_EQ(frame.get_changed_cells(), 4);
+}
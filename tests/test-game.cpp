@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "game.h"
+#include "undo-ring.h"
+
+// --- Helpers ---
+
+static Game started_game() {
+    Game game;
+    game.init();
+    return game;
+}
+
+// --- Main Tests ---
+
+TEST(game, Initialization) {
+    const auto game = started_game();
+
+    EXPECT_FALSE(game.is_over());
+    EXPECT_TRUE(game.get_current_shape().is_valid());
+    EXPECT_FALSE(game.get_held_shape().is_valid());
+    EXPECT_EQ(game.get_current_shape().position, game.get_current_shape().get_spawn_position());
+    EXPECT_EQ(game.get_landing_position().y, GAME_GRID_HEIGHT - game.get_current_shape().get_size().y);
+}
+
+TEST(game, MoveUntilWall) {
+    auto game = started_game();
+
+    while (game.apply(Action::Left)) {}
+    EXPECT_EQ(game.get_current_shape().position.x, 0);
+
+    while (game.apply(Action::Right)) {}
+    EXPECT_EQ(game.get_current_shape().position.x, GAME_GRID_WIDTH - game.get_current_shape().get_size().x);
+}
+
+TEST(game, TickMovesShapeDown) {
+    auto       game = started_game();
+    const auto y    = game.get_current_shape().position.y;
+
+    EXPECT_TRUE(game.tick());
+    EXPECT_EQ(game.get_current_shape().position.y, y + 1);
+}
+
+TEST(game, HardDropPlacesShape) {
+    auto        game    = started_game();
+    const Shape shape   = game.get_current_shape();
+    const Vec2  landing = game.get_landing_position();
+    const Vec2  size    = shape.get_size();
+
+    EXPECT_TRUE(game.apply(Action::HardDrop));
+    EXPECT_EQ(game.get_pieces_placed(), 1u);
+
+    for (int y = 0; y < size.y; ++y) {
+        for (int x = 0; x < size.x; ++x) {
+            EXPECT_EQ(game.get_grid()(landing.x + x, landing.y + y), shape.get_block(x, y));
+            EXPECT_EQ(game.get_occupancy().is_filled(landing.x + x, landing.y + y), shape.get_block(x, y) != 0);
+        }
+    }
+}
+
+TEST(game, HoldOncePerShape) {
+    auto       game = started_game();
+    const auto type = game.get_current_shape().type;
+
+    EXPECT_TRUE(game.apply(Action::Hold));
+    EXPECT_EQ(game.get_held_shape().type, type);
+    EXPECT_FALSE(game.is_swap_allowed());
+    EXPECT_FALSE(game.apply(Action::Hold));
+
+    game.apply(Action::HardDrop);
+    EXPECT_TRUE(game.is_swap_allowed());
+}
+
+TEST(game, LineClear) {
+    auto        game  = started_game();
+    const Shape shape = game.get_current_shape();
+    const auto  size  = shape.get_size();
+    const auto  x     = shape.position.x;
+
+    // Fill the bottom row except the cells covered by the bottom row of the current shape
+    GameGrid grid;
+    for (int column = 0; column < GAME_GRID_WIDTH; ++column) {
+        const bool covered = column >= x && column < x + size.x && shape.get_block(column - x, size.y - 1) != 0;
+        if (!covered) { grid(column, GAME_GRID_HEIGHT - 1) = 1; }
+    }
+    game.set_grid(grid);
+
+    game.apply(Action::HardDrop);
+
+    EXPECT_EQ(game.get_lines_cleared(), 1u);
+    EXPECT_EQ(game.get_last_clear().count, 1);
+    EXPECT_EQ(game.get_last_clear().rows[0], GAME_GRID_HEIGHT - 1);
+    EXPECT_FALSE(game.get_occupancy().is_row_full(GAME_GRID_HEIGHT - 1));
+}
+
+TEST(game, MultiLineClearMatchesReference) {
+    std::mt19937 rng(42);
+
+    for (int round = 0; round < 64; ++round) {
+        const int top = static_cast<int>(rng() % (GAME_GRID_HEIGHT - 3));
+
+        // Random rows, with random full rows inside the checked range
+        GameGrid grid;
+        for (int y = 0; y < GAME_GRID_HEIGHT; ++y) {
+            const bool full = y >= top && y < top + 4 && rng() % 2 == 0;
+            for (int x = 0; x < GAME_GRID_WIDTH; ++x) { grid(x, y) = full || rng() % 3 != 0 ? static_cast<unsigned char>(1 + y % 7) : 0; }
+            if (!full) { grid(static_cast<int>(rng() % GAME_GRID_WIDTH), y) = 0; }
+        }
+
+        // Reference: keep the non-full rows, bottom aligned
+        GameGrid         expected;
+        std::vector<int> removed;
+        for (int y = GAME_GRID_HEIGHT - 1, destination = GAME_GRID_HEIGHT - 1; y >= 0; --y) {
+            bool full = true;
+            for (int x = 0; x < GAME_GRID_WIDTH; ++x) { full = full && grid(x, y) != 0; }
+            if (full) {
+                removed.insert(removed.begin(), y);
+                continue;
+            }
+            for (int x = 0; x < GAME_GRID_WIDTH; ++x) { expected(x, destination) = grid(x, y); }
+            --destination;
+        }
+
+        Game game;
+        game.set_grid(grid);
+        const auto clear = game.remove_filled_lines(top, 4);
+
+        ASSERT_EQ(clear.count, static_cast<int>(removed.size()));
+        for (int i = 0; i < clear.count; ++i) { EXPECT_EQ(clear.rows[i], removed[i]); }
+        for (int y = 0; y < GAME_GRID_HEIGHT; ++y) {
+            for (int x = 0; x < GAME_GRID_WIDTH; ++x) {
+                EXPECT_EQ(game.get_grid()(x, y), expected(x, y));
+                EXPECT_EQ(game.get_occupancy().is_filled(x, y), expected(x, y) != 0);
+            }
+        }
+    }
+}
+
+TEST(game, LineClearRangeOutsideTheGrid) {
+    // Fill every row, so any row read outside the checked range would be cleared
+    GameGrid grid;
+    for (int y = 0; y < GAME_GRID_HEIGHT; ++y) {
+        for (int x = 0; x < GAME_GRID_WIDTH; ++x) { grid(x, y) = 1; }
+    }
+
+    Game game;
+    game.set_grid(grid);
+
+    // Asserted in debug builds, clamped to at most 4 rows of the grid otherwise
+    EXPECT_DEBUG_DEATH(EXPECT_LE(game.remove_filled_lines(GAME_GRID_HEIGHT - 2, 8).count, 2), "");
+    EXPECT_DEBUG_DEATH(EXPECT_LE(game.remove_filled_lines(-3, BITBOARD_SHAPE_ROWS).count, BITBOARD_SHAPE_ROWS), "");
+}
+
+TEST(game, SkylineAndLandingMatchStepping) {
+    std::mt19937 rng(7);
+
+    auto game = started_game();
+    for (int step = 0; step < 5000; ++step) {
+        if (game.is_over()) { game = started_game(); }
+
+        if (rng() % 8 == 0) {
+            game.tick();
+        } else {
+            game.apply(static_cast<Action>(rng() % 6));
+        }
+        if (game.is_over()) { continue; }
+
+        // The skyline must match the occupancy
+        EXPECT_EQ(game.get_skyline(), game.get_occupancy().column_heights());
+
+        // The landing position must match dropping the shape row by row
+        const auto &shape   = game.get_current_shape();
+        Vec2        landing = shape.position;
+        while (game.is_shape_placeable(shape, landing + Vec2(0, 1))) { landing += Vec2(0, 1); }
+        ASSERT_EQ(game.get_landing_position(), landing);
+    }
+}
+
+TEST(game, GameOver) {
+    auto game = started_game();
+
+    // Fill every row but leave one hole so no line can be cleared
+    GameGrid grid;
+    for (int y = 2; y < GAME_GRID_HEIGHT; ++y) { for (int x = 1; x < GAME_GRID_WIDTH; ++x) { grid(x, y) = 1; } }
+    game.set_grid(grid);
+
+    while (!game.is_over()) { game.apply(Action::HardDrop); }
+
+    EXPECT_TRUE(game.is_over());
+    EXPECT_FALSE(game.apply(Action::Left));
+    EXPECT_FALSE(game.tick());
+}
+
+// --- Snapshot Tests ---
+
+static_assert(std::is_trivially_copyable_v<Game>, "A game must copy without allocating");
+
+TEST(game, RestoreReplaysTheSameGame) {
+    Game game;
+    game.init(99);
+    for (int i = 0; i < 20; ++i) {
+        game.apply(Action::Left);
+        game.apply(Action::HardDrop);
+    }
+
+    const auto snapshot = game.snapshot();
+    const auto checksum = game.get_checksum();
+
+    // Play on, through several bags, then go back
+    const auto play = [](Game &played) {
+        for (int i = 0; i < 30 && !played.is_over(); ++i) {
+            played.apply(i % 3 == 0 ? Action::Hold : Action::Rotate);
+            played.apply(Action::HardDrop);
+            played.tick();
+        }
+    };
+    play(game);
+    const auto played_checksum = game.get_checksum();
+
+    game.restore(snapshot);
+    EXPECT_EQ(game.get_checksum(), checksum);
+
+    // The shape generator is restored too, so the same actions play the same game
+    play(game);
+    EXPECT_EQ(game.get_checksum(), played_checksum);
+}
+
+TEST(game, UndoLastPlacements) {
+    Game game;
+    game.init(3);
+
+    UndoRing<GameState, 4>     history;
+    std::vector<std::uint64_t> checksums;
+    for (int i = 0; i < 6; ++i) {
+        checksums.push_back(game.get_checksum());
+        history.push(game.snapshot());
+        game.apply(Action::HardDrop);
+    }
+    EXPECT_EQ(history.size(), 4u);
+
+    // Only the last 4 placements can be taken back, newest first
+    GameState state;
+    for (int i = 5; i >= 2; --i) {
+        ASSERT_TRUE(history.pop(state));
+        game.restore(state);
+        EXPECT_EQ(game.get_checksum(), checksums[i]);
+        EXPECT_EQ(game.get_pieces_placed(), static_cast<unsigned int>(i));
+    }
+    EXPECT_FALSE(history.pop(state));
+}
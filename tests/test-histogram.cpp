@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include "histogram.h"
+
+// --- Bucket Tests ---
+
+TEST(histogram, SmallValuesAreExact) {
+    for (std::uint64_t value = 0; value < 2 * Histogram::SUB_BUCKETS; ++value) {
+        const auto bucket = Histogram::bucket_of(value);
+        EXPECT_EQ(Histogram::bucket_lower(bucket), value);
+        EXPECT_EQ(Histogram::bucket_upper(bucket), value);
+    }
+}
+
+TEST(histogram, BucketsContainTheirValues) {
+    for (std::uint64_t value = 1; value < (std::uint64_t{1} << 62); value = value * 3 + 1) {
+        const auto bucket = Histogram::bucket_of(value);
+        ASSERT_LT(bucket, Histogram::BUCKETS);
+        EXPECT_LE(Histogram::bucket_lower(bucket), value);
+        EXPECT_GE(Histogram::bucket_upper(bucket), value);
+        EXPECT_LE(Histogram::bucket_upper(bucket) - Histogram::bucket_lower(bucket), value / Histogram::SUB_BUCKETS);
+    }
+}
+
+// --- Statistics Tests ---
+
+TEST(histogram, Empty) {
+    const Histogram histogram;
+
+    EXPECT_EQ(histogram.get_count(), 0u);
+    EXPECT_EQ(histogram.get_min(), 0u);
+    EXPECT_EQ(histogram.percentile(50), 0u);
+}
+
+TEST(histogram, Percentiles) {
+    Histogram histogram;
+    for (std::uint64_t value = 1; value <= 1000; ++value) { histogram.record(value); }
+
+    EXPECT_EQ(histogram.get_count(), 1000u);
+    EXPECT_EQ(histogram.get_min(), 1u);
+    EXPECT_EQ(histogram.get_max(), 1000u);
+    EXPECT_DOUBLE_EQ(histogram.get_mean(), 500.5);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(50)), 500.0, 500.0 / Histogram::SUB_BUCKETS);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(99)), 990.0, 990.0 / Histogram::SUB_BUCKETS);
+    EXPECT_EQ(histogram.percentile(100), 1000u);
+}
+
+TEST(histogram, Merge) {
+    Histogram a;
+    Histogram b;
+    a.record(10);
+    b.record(20, 3);
+
+    a.merge(b);
+
+    EXPECT_EQ(a.get_count(), 4u);
+    EXPECT_EQ(a.get_min(), 10u);
+    EXPECT_EQ(a.get_max(), 20u);
+    EXPECT_EQ(a.percentile(50), 20u);
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "key-repeat.h"
+
+using std::chrono::milliseconds;
+
+// --- Helpers ---
+
+static KeyRepeat::time_point at(const int ms) { return KeyRepeat::time_point(milliseconds(ms)); }
+
+// --- Main Tests ---
+
+TEST(key_repeat, SinglePress) {
+    KeyRepeat repeat;
+
+    EXPECT_EQ(repeat.press(at(0)), 1);
+    EXPECT_EQ(repeat.update(at(INPUT_DAS_MS + INPUT_ARR_MS * 4)), 0);
+    EXPECT_FALSE(repeat.is_held(at(INPUT_REPEAT_DELAY_MS + 1)));
+}
+
+TEST(key_repeat, SeparateTapsMoveOnceEach) {
+    KeyRepeat repeat;
+
+    EXPECT_EQ(repeat.press(at(0)), 1);
+    EXPECT_EQ(repeat.press(at(300)), 1);
+    EXPECT_FALSE(repeat.is_repeating());
+    EXPECT_EQ(repeat.update(at(350)), 0);
+}
+
+TEST(key_repeat, HeldKeyUsesOwnRepeatRate) {
+    KeyRepeat repeat;
+
+    // Terminal: first repeat after 500ms, then every 30ms
+    EXPECT_EQ(repeat.press(at(0)), 1);
+    EXPECT_EQ(repeat.press(at(500)), 1);
+    EXPECT_EQ(repeat.press(at(530)), 1);
+    EXPECT_TRUE(repeat.is_repeating());
+
+    // Terminal repeats are absorbed, our timer drives the key
+    EXPECT_EQ(repeat.press(at(560)), 0);
+    EXPECT_EQ(repeat.update(at(530 + INPUT_ARR_MS)), 1);
+    EXPECT_EQ(repeat.press(at(590)), 0);
+    EXPECT_EQ(repeat.update(at(530 + INPUT_ARR_MS * 3)), 2);
+}
+
+TEST(key_repeat, ReleaseStopsRepeating) {
+    KeyRepeat repeat;
+    repeat.press(at(0));
+    repeat.press(at(500));
+    repeat.press(at(530));
+
+    const auto release = 530 + INPUT_RELEASE_MS + 1;
+    EXPECT_FALSE(repeat.is_held(at(release)));
+    EXPECT_EQ(repeat.update(at(release)), 0);
+    EXPECT_FALSE(repeat.is_repeating());
+    EXPECT_FALSE(repeat.next_deadline().has_value());
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <type_traits>
+
 #include "board-matrix.h"
 
 // --- Main Tests ---
@@ -90,8 +92,11 @@ TEST(matrix, MoveConstructor) {
     original(0, 1) = 3;
     original(1, 1) = 4;
 
+    const auto *cells = original.get_raw();
     BoardMatrix moved(std::move(original));
 
+    EXPECT_EQ(moved.get_raw(), cells); // The cells are moved, not copied
+    EXPECT_TRUE(original.is_empty());
     EXPECT_EQ(moved.get_width(), 2);
     EXPECT_EQ(moved.get_height(), 2);
     EXPECT_EQ(moved(0, 0), 1);
@@ -148,3 +153,62 @@ TEST(matrix, CounterClockwiseRotation) {
     EXPECT_EQ(rotated(0, 1), 1);
     EXPECT_EQ(rotated(1, 1), 3);
 }
+
+// --- Fixed Extent Tests ---
+
+using FixedMatrix = BoardMatrix<unsigned char, 3, 2>;
+
+static_assert(std::is_trivially_copyable_v<FixedMatrix>, "Fixed matrices must copy like plain arrays");
+static_assert(sizeof(FixedMatrix) == 3 * 2, "Fixed matrices must store nothing but their cells");
+static_assert(FixedMatrix::get_width() == 3 && FixedMatrix::get_height() == 2 && FixedMatrix::get_index(2, 1) == 5);
+
+TEST(matrix, FixedInitialization) {
+    const FixedMatrix zeros;
+    const FixedMatrix sevens(7);
+
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 3; ++x) {
+            EXPECT_EQ(zeros(x, y), 0);
+            EXPECT_EQ(sevens(x, y), 7);
+        }
+    }
+    EXPECT_FALSE(zeros.is_empty());
+}
+
+TEST(matrix, FixedCopy) {
+    FixedMatrix original;
+    original(2, 1) = 9;
+
+    auto copy = original;
+    copy(0, 0) = 1;
+
+    EXPECT_EQ(copy(2, 1), 9);
+    EXPECT_EQ(original(0, 0), 0);
+    EXPECT_NE(copy, original);
+}
+
+TEST(matrix, FixedRotationMatchesDynamic) {
+    FixedMatrix                fixed;
+    BoardMatrix<unsigned char> dynamic(3, 2);
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 3; ++x) {
+            fixed(x, y)   = static_cast<unsigned char>(1 + y * 3 + x);
+            dynamic(x, y) = static_cast<unsigned char>(1 + y * 3 + x);
+        }
+    }
+
+    constexpr auto rotated_size = Vec2(2, 3);
+    const auto     clockwise    = fixed.rotate_clockwise();
+    const auto     counter      = fixed.rotate_counter_clockwise();
+    const auto     expected_cw  = dynamic.rotate_clockwise();
+    const auto     expected_ccw = dynamic.rotate_counter_clockwise();
+
+    EXPECT_EQ(clockwise.get_width(), rotated_size.x);
+    EXPECT_EQ(clockwise.get_height(), rotated_size.y);
+    for (int y = 0; y < rotated_size.y; ++y) {
+        for (int x = 0; x < rotated_size.x; ++x) {
+            EXPECT_EQ(clockwise(x, y), expected_cw(x, y));
+            EXPECT_EQ(counter(x, y), expected_ccw(x, y));
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "game.h"
+#include "metrics.h"
+
+// --- Registry Tests ---
+
+TEST(metrics, RecordsPhasesAndCounters) {
+    Metrics metrics;
+    metrics.record(Phase::Draw, 1000);
+    metrics.record(Phase::Draw, 3000);
+    metrics.count(Counter::CellsDrawn, 5);
+    metrics.count(Counter::CellsDrawn);
+
+    EXPECT_EQ(metrics.get_phase(Phase::Draw).get_count(), 2u);
+    EXPECT_EQ(metrics.get_phase(Phase::Draw).get_max(), 3000u);
+    EXPECT_EQ(metrics.get_phase(Phase::Tick).get_count(), 0u);
+    EXPECT_EQ(metrics.get_counter(Counter::CellsDrawn), 6u);
+
+    metrics.reset();
+    EXPECT_EQ(metrics.get_phase(Phase::Draw).get_count(), 0u);
+    EXPECT_EQ(metrics.get_counter(Counter::CellsDrawn), 0u);
+}
+
+TEST(metrics, TimerRecordsScope) {
+    auto &metrics = Metrics::local();
+    metrics.reset();
+
+    { PhaseTimer timer(Phase::Bot); }
+
+    EXPECT_EQ(metrics.get_phase(Phase::Bot).get_count(), METRICS_ENABLED ? 1u : 0u);
+}
+
+TEST(metrics, GameCountsEvents) {
+    auto &metrics = Metrics::local();
+    metrics.reset();
+
+    // Fill the bottom row but its first four cells, and drop a flat I shape into the gap
+    GameGrid grid;
+    for (int x = 4; x < GAME_GRID_WIDTH; ++x) { grid(x, GAME_GRID_HEIGHT - 1) = 1; }
+
+    for (std::uint64_t seed = 0;; ++seed) {
+        Game game;
+        game.init(seed);
+        if (game.get_current_shape().type != 0) { continue; }
+
+        game.set_grid(grid);
+        metrics.reset();
+        while (game.get_current_shape().get_size().x != 4) { ASSERT_TRUE(game.apply(Action::Rotate)); }
+        while (game.apply(Action::Left)) {}
+        ASSERT_TRUE(game.apply(Action::HardDrop));
+        ASSERT_EQ(game.get_lines_cleared(), 1u);
+        break;
+    }
+
+    if constexpr (METRICS_ENABLED) {
+        EXPECT_GT(metrics.get_counter(Counter::CollisionChecks), 0u);
+        EXPECT_EQ(metrics.get_counter(Counter::LinesCleared), 1u);
+    }
+}
+
+TEST(metrics, LocalPerThread) {
+    Metrics::local().reset();
+    Metrics::local().count(Counter::LinesCleared, 4);
+
+    std::thread([] { EXPECT_EQ(Metrics::local().get_counter(Counter::LinesCleared), 0u); }).join();
+    EXPECT_EQ(Metrics::local().get_counter(Counter::LinesCleared), 4u);
+}
+
+// --- Dump Tests ---
+
+TEST(metrics, DumpsHistograms) {
+    Metrics metrics;
+    metrics.record(Phase::Frame, 2000);
+    metrics.count(Counter::LinesCleared, 3);
+
+    const auto path = testing::TempDir() + "metrics.txt";
+    ASSERT_TRUE(metrics.dump(path));
+
+    std::ifstream     file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::remove(path.c_str());
+
+    const auto text = contents.str();
+    EXPECT_NE(text.find("frame count 1 "), std::string::npos);
+    EXPECT_NE(text.find("input count 0 "), std::string::npos);
+    EXPECT_NE(text.find("lines 3\n"), std::string::npos);
+    EXPECT_NE(text.find("# buckets frame\n"), std::string::npos);
+
+    EXPECT_FALSE(metrics.dump(testing::TempDir() + "missing/metrics.txt"));
+}
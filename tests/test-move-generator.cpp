@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <tuple>
+
+#include "move-generator.h"
+
+// --- Helpers ---
+
+using Cells = std::array<BitRow, Bitboard::HEIGHT>; // Cells of a locked shape
+
+static Cells locked_cells(const Shape &shape, const Vec2 &position) {
+    Bitboard cells;
+    cells.place(shape.get_mask(), shape.get_size().y, position);
+    return cells.rows;
+}
+
+// Started game of the given grid whose current shape has the given type
+static Game game_with_shape(const unsigned int type, const GameGrid &grid) {
+    for (std::uint64_t seed = 0;; ++seed) {
+        Game game;
+        game.init(seed);
+        if (game.get_current_shape().type == type) {
+            game.set_grid(grid);
+            return game;
+        }
+    }
+}
+
+// Random stack of the bottom rows, with holes and overhangs, never a full row
+static GameGrid make_cave_grid(const unsigned int seed) {
+    GameGrid     grid;
+    std::mt19937 rng(seed);
+    for (int y = GAME_GRID_HEIGHT / 2; y < GAME_GRID_HEIGHT; ++y) {
+        const auto hole = static_cast<int>(rng() % GAME_GRID_WIDTH);
+        for (int x = 0; x < GAME_GRID_WIDTH; ++x) {
+            if (x != hole && rng() % 3 == 0) { grid(x, y) = 1; }
+        }
+    }
+    return grid;
+}
+
+// Cells of every lock position reached by playing moves on copies of the game
+static std::set<Cells> brute_force_placements(const Game &game) {
+    std::set<Cells>                     placements;
+    std::set<std::tuple<int, int, int>> seen;
+    std::vector<Game>                   queue = {game};
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        const auto &shape = queue[i].get_current_shape();
+        if (!seen.emplace(shape.rotation, shape.position.x, shape.position.y).second) { continue; }
+
+        placements.insert(locked_cells(shape, queue[i].get_landing_position()));
+        for (const auto action : {Action::Left, Action::Right, Action::SoftDrop, Action::Rotate}) {
+            auto moved = queue[i];
+            if (moved.apply(action)) { queue.push_back(std::move(moved)); }
+        }
+    }
+    return placements;
+}
+
+// --- Generation Tests ---
+
+TEST(move_generator, EmptyBoardPlacements) {
+    // Every rotation with distinct cells, in every column it fits
+    constexpr int expected[SHAPE_COUNT] = {17, 34, 34, 9, 17, 34, 17};
+
+    MoveGenerator generator;
+    for (unsigned int type = 0; type < SHAPE_COUNT; ++type) {
+        Shape shape(type);
+        shape.position = shape.get_spawn_position();
+
+        EXPECT_EQ(generator.generate(Bitboard(), shape), expected[type]) << "shape " << type;
+        for (const auto &placement : generator) {
+            EXPECT_EQ(placement.shape.position.y + placement.shape.get_size().y, Bitboard::HEIGHT);
+        }
+    }
+}
+
+TEST(move_generator, BlockedSpawn) {
+    Bitboard board;
+    board.rows.fill(Bitboard::FULL_ROW >> 1);
+
+    Shape shape(0);
+    shape.position = shape.get_spawn_position();
+
+    MoveGenerator generator;
+    EXPECT_EQ(generator.generate(board, shape), 0);
+    EXPECT_EQ(generator.begin(), generator.end());
+}
+
+TEST(move_generator, TucksUnderOverhangs) {
+    // An overhang over the left columns, only reachable by sliding under it after a soft drop
+    GameGrid grid;
+    for (int x = 0; x < 4; ++x) { grid(x, GAME_GRID_HEIGHT - 4) = 1; }
+    for (int x = 4; x < GAME_GRID_WIDTH; ++x) { grid(x, GAME_GRID_HEIGHT - 1) = 1; }
+
+    auto game = game_with_shape(3, grid); // O shape
+
+    MoveGenerator generator;
+    generator.generate(game.get_occupancy(), game.get_current_shape());
+
+    const auto tuck = std::find_if(generator.begin(), generator.end(), [](const Placement &placement) { return placement.shape.position == Vec2(0, GAME_GRID_HEIGHT - 2); });
+    ASSERT_NE(tuck, generator.end());
+
+    const auto path = generator.get_path(*tuck);
+    EXPECT_NE(std::find(path.begin(), path.end(), Action::SoftDrop), path.end());
+
+    for (const auto action : path) { ASSERT_TRUE(game.apply(action)); }
+    EXPECT_TRUE(game.get_grid()(0, GAME_GRID_HEIGHT - 1) != 0 && game.get_grid()(1, GAME_GRID_HEIGHT - 2) != 0);
+}
+
+TEST(move_generator, MatchesBruteForce) {
+    MoveGenerator generator;
+    for (unsigned int seed = 0; seed < 12; ++seed) {
+        const auto grid = make_cave_grid(seed);
+        for (unsigned int type = 0; type < SHAPE_COUNT; ++type) {
+            const auto game = game_with_shape(type, grid);
+
+            const auto count = generator.generate(game.get_occupancy(), game.get_current_shape());
+
+            // Every placement is distinct, and its path plays it through the game rules
+            std::set<Cells> found;
+            for (const auto &placement : generator) {
+                ASSERT_TRUE(found.insert(locked_cells(placement.shape, placement.shape.position)).second);
+
+                auto played = game;
+                generator.for_each_action(placement, [&](const Action action) {
+                    if (action == Action::HardDrop) {
+                        EXPECT_EQ(played.get_current_shape().rotation, placement.shape.rotation);
+                        EXPECT_EQ(played.get_landing_position(), placement.shape.position);
+                    }
+                    EXPECT_TRUE(played.apply(action));
+                });
+            }
+
+            EXPECT_EQ(static_cast<int>(found.size()), count);
+            EXPECT_EQ(found, brute_force_placements(game)) << "seed " << seed << ", shape " << type;
+        }
+    }
+}
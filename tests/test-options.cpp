@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "options.h"
+
+// --- Option Tests ---
+
+TEST(options, ParsesWholeNumbers) {
+    std::uint64_t seed = 0;
+    EXPECT_TRUE(parse_option("18446744073709551615", seed));
+    EXPECT_EQ(seed, UINT64_MAX);
+
+    int port = 0;
+    EXPECT_TRUE(parse_option("-1", port));
+    EXPECT_EQ(port, -1);
+
+    double duration = 0;
+    EXPECT_TRUE(parse_option("2.5", duration));
+    EXPECT_DOUBLE_EQ(duration, 2.5);
+}
+
+TEST(options, RejectsOtherText) {
+    unsigned int value = 7;
+    EXPECT_FALSE(parse_option("", value));
+    EXPECT_FALSE(parse_option("abc", value));
+    EXPECT_FALSE(parse_option("12abc", value));
+    EXPECT_FALSE(parse_option("-1", value));
+    EXPECT_FALSE(parse_option("4294967296", value));
+    EXPECT_EQ(value, 7u);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include "random.h"
+
+// --- Generator Tests ---
+
+TEST(random, ReferenceSequence) {
+    // splitmix64 seeding and xoshiro256** output of the reference implementations, seed 0
+    Xoshiro256 engine(0);
+
+    EXPECT_EQ(engine(), 0x99EC5F36CB75F2B4ull);
+    EXPECT_EQ(engine(), 0xBF6E1F784956452Aull);
+    EXPECT_EQ(engine(), 0x1A5F849D4933E6E0ull);
+}
+
+TEST(random, SeedIsReproducible) {
+    Xoshiro256 first(123), second(123), other(124);
+
+    for (int i = 0; i < 100; ++i) {
+        const auto value = first();
+        EXPECT_EQ(value, second());
+        EXPECT_NE(value, other());
+    }
+}
+
+TEST(random, StreamsJumpAhead) {
+    auto jumped = Xoshiro256(9);
+    jumped.jump();
+    jumped.jump();
+
+    EXPECT_EQ(Xoshiro256::stream(9, 0), Xoshiro256(9));
+    EXPECT_EQ(Xoshiro256::stream(9, 2), jumped);
+    EXPECT_NE(Xoshiro256::stream(9, 1), Xoshiro256::stream(9, 2));
+
+    auto long_jumped = Xoshiro256(9);
+    long_jumped.long_jump();
+    EXPECT_NE(long_jumped, Xoshiro256(9));
+    EXPECT_NE(long_jumped, Xoshiro256::stream(9, 1));
+}
+
+// --- Bounded Integer Tests ---
+
+TEST(random, BoundedStaysInRange) {
+    Xoshiro256 engine(5);
+
+    for (std::uint32_t bound : {1u, 2u, 7u, 1000u, 0x80000001u, 0xFFFFFFFFu}) {
+        for (int i = 0; i < 1000; ++i) { EXPECT_LT(Random::bounded(engine, bound), bound); }
+    }
+}
+
+TEST(random, BoundedIsUniform) {
+    Xoshiro256         engine(6);
+    std::array<int, 7> counts{};
+    constexpr int      samples = 70000;
+
+    for (int i = 0; i < samples; ++i) { ++counts[Random::bounded(engine, 7)]; }
+
+    // Every value within 5% of its expected frequency
+    for (const auto count : counts) { EXPECT_NEAR(count, samples / 7, samples / 7 / 20); }
+}
+
+TEST(random, BoundedWorksWith32BitEngines) {
+    std::mt19937 engine(1);
+
+    bool seen[3] = {};
+    for (int i = 0; i < 100; ++i) { seen[Random::bounded(engine, 3)] = true; }
+    EXPECT_TRUE(seen[0] && seen[1] && seen[2]);
+}
+
+TEST(random, IntInRangeIsInclusive) {
+    Random::seed(77);
+
+    bool seen[3] = {};
+    for (int i = 0; i < 200; ++i) {
+        const auto value = Random::int_in_range(-1, 1);
+        ASSERT_GE(value, -1);
+        ASSERT_LE(value, 1);
+        seen[value + 1] = true;
+    }
+    EXPECT_TRUE(seen[0] && seen[1] && seen[2]);
+}
+
+TEST(random, IntInRangeCoversWholeTypes) {
+    Random::seed(77);
+
+    // Ranges as wide as their type, whose span does not fit the signed type itself
+    bool negative = false;
+    bool positive = false;
+    for (int i = 0; i < 200; ++i) {
+        const auto value = Random::int_in_range<int>(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+        negative |= value < 0;
+        positive |= value > 0;
+
+        ASSERT_GE(Random::int_in_range<long long>(-5, std::numeric_limits<long long>::max()), -5);
+        ASSERT_LE(Random::int_in_range<long long>(std::numeric_limits<long long>::min(), 5), 5);
+        ASSERT_GE(Random::int_in_range<std::int8_t>(-128, 127), -128);
+    }
+    EXPECT_TRUE(negative && positive);
+
+    // The last span of the bounded path, and the first one past it
+    for (int i = 0; i < 200; ++i) {
+        const auto fast = Random::int_in_range<long long>(-1, 0xFFFFFFFDll);
+        ASSERT_GE(fast, -1);
+        ASSERT_LE(fast, 0xFFFFFFFDll);
+
+        const auto wide = Random::int_in_range<long long>(-1, 0xFFFFFFFEll);
+        ASSERT_GE(wide, -1);
+        ASSERT_LE(wide, 0xFFFFFFFEll);
+    }
+
+    EXPECT_EQ(Random::int_in_range<int>(std::numeric_limits<int>::max(), std::numeric_limits<int>::max()), std::numeric_limits<int>::max());
+}
+
+// --- Shuffle Tests ---
+
+TEST(random, ShuffleIsPermutation) {
+    Xoshiro256 engine(8);
+
+    for (int round = 0; round < 100; ++round) {
+        std::array<int, 7> bag = {0, 1, 2, 3, 4, 5, 6};
+        Random::shuffle(bag.begin(), bag.end(), engine);
+
+        std::array<bool, 7> seen{};
+        for (const auto value : bag) { seen[value] = true; }
+        for (const auto value : seen) { EXPECT_TRUE(value); }
+    }
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "renderer.h"
+#include "scene.h"
+
+// --- Helpers ---
+
+// One character per cell: its glyph, or for a blank colored cell a letter of its color (uppercase when inverted)
+static std::wstring picture(const MemoryRenderer &renderer) {
+    std::wstring text;
+    for (int y = 0; y < renderer.get_height(); ++y) {
+        for (int x = 0; x < renderer.get_width(); ++x) {
+            const auto &cell = renderer.get_cell(x, y);
+            if (cell.glyph != L' ' || cell.color <= static_cast<short>(Colors::Default)) { text += cell.glyph; }
+            else if (cell.color == static_cast<short>(Colors::Black)) { text += L'.'; }
+            else if (cell.color > COLOR_INVERTED_OFFSET) { text += static_cast<wchar_t>(L'A' + cell.color - COLOR_INVERTED_OFFSET - 1); }
+            else { text += static_cast<wchar_t>(L'a' + cell.color - 1); }
+        }
+        text += L'\n';
+    }
+    return text;
+}
+
+// Game with a held shape and a placed one
+static Game make_scene_game() {
+    Game game;
+    game.init(42);
+    game.apply(Action::Hold);
+    game.apply(Action::Left);
+    game.apply(Action::HardDrop);
+    return game;
+}
+
+static void draw_frame(Renderer &renderer, Scene &scene, const Game &game) {
+    renderer.update();
+    scene.draw(renderer, game);
+    renderer.refresh();
+}
+
+// --- Primitive Tests ---
+
+TEST(renderer, DrawsPrimitives) {
+    MemoryRenderer renderer(Vec2(8, 4));
+
+    renderer.update();
+    renderer.draw_border(Rect(0, 0, 7, 3));
+    renderer.draw_text(Vec2(1, 1), L"Hi");
+    renderer.set_color(Colors::Red, true);
+    renderer.draw_pixel(Vec2(4, 2), L' ');
+    renderer.refresh();
+
+    EXPECT_EQ(picture(renderer), L"┌──────┐\n"
+                                 L"│Hi    │\n"
+                                 L"│   CC │\n"
+                                 L"└──────┘\n");
+    EXPECT_EQ(renderer.get_changed_cells(), 32);
+}
+
+TEST(renderer, ReportsOverbound) {
+    MemoryRenderer renderer(Vec2(16, 3));
+
+    renderer.update();
+    renderer.draw_char(Vec2(16, 0), L'x');
+    renderer.refresh();
+
+    EXPECT_EQ(renderer.get_text(), L"                \n"
+                                   L" Out of bounds! \n"
+                                   L"                \n");
+}
+
+TEST(renderer, ResizeRedrawsEverything) {
+    MemoryRenderer renderer(Vec2(4, 2));
+    renderer.update();
+    renderer.refresh();
+    renderer.update();
+    renderer.refresh();
+    EXPECT_FALSE(renderer.is_resized());
+    EXPECT_EQ(renderer.get_changed_cells(), 0);
+
+    renderer.set_size(Vec2(6, 3));
+    renderer.update();
+    renderer.refresh();
+    EXPECT_TRUE(renderer.is_resized());
+    EXPECT_EQ(renderer.get_changed_cells(), 18);
+    EXPECT_EQ(renderer.get_frames(), 3u);
+}
+
+TEST(renderer, NullDrawsNothing) {
+    NullRenderer renderer;
+    Scene        scene;
+
+    EXPECT_FALSE(renderer.is_drawn());
+    draw_frame(renderer, scene, make_scene_game());
+    EXPECT_EQ(renderer.get_size(), Vec2());
+    EXPECT_EQ(renderer.get_changed_cells(), 0);
+    EXPECT_EQ(renderer.read_key(), KEY_CODE_NONE);
+}
+
+TEST(renderer, NullNeverWaits) {
+    NullRenderer renderer;
+
+    // A run with nothing drawn must not keep the pace of the real deadlines
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(renderer.wait_input(std::chrono::seconds(10)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+// --- Scene Tests ---
+
+TEST(renderer, SceneGoldenFrame) {
+    MemoryRenderer renderer(Vec2(36, 22));
+    Scene          scene;
+    draw_frame(renderer, scene, make_scene_game());
+
+    EXPECT_EQ(picture(renderer), L"  ┌HELD────┐┌────────────────────┐  \n"
+                                 L"  │        ││........FFFF........│  \n"
+                                 L"  │CCCCCCCC││........FFFF........│  \n"
+                                 L"  │        ││....................│  \n"
+                                 L"  │        ││....................│  \n"
+                                 L"  └────────┘│....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │....................│  \n"
+                                 L"            │........░░░░........│  \n"
+                                 L"            │........░░░░........│  \n"
+                                 L"            │......EEEEEE........│  \n"
+                                 L"            │......EE............│  \n"
+                                 L"            └────────────────────┘  \n");
+}
+
+TEST(renderer, SceneRefreshesOnlyChanges) {
+    MemoryRenderer renderer(Vec2(36, 22));
+    Scene          scene;
+    auto           game = make_scene_game();
+    draw_frame(renderer, scene, game);
+
+    draw_frame(renderer, scene, game);
+    EXPECT_EQ(renderer.get_changed_cells(), 0);
+
+    // The O shape and its shadow move by one pixel: on each of their 4 rows, 2 cells appear and 2 disappear
+    ASSERT_TRUE(game.apply(Action::Left));
+    draw_frame(renderer, scene, game);
+    EXPECT_EQ(renderer.get_changed_cells(), 4 * (2 + 2));
+}
+
+TEST(renderer, SceneMetricsOverlay) {
+    MemoryRenderer renderer(Vec2(70, 22));
+    Scene          scene;
+    const auto     game = make_scene_game();
+
+    // Under the held box, right-aligned with it
+    const auto origin = Vec2(35 - GAME_GRID_WIDTH / 2, 11 - GAME_GRID_HEIGHT / 2);
+    const auto hud    = origin + Vec2(-GAME_HUD_WIDTH - 2, GAME_HELD_HEIGHT + 2);
+    const auto row    = [&](const int y) { return picture(renderer).substr((hud.y + y) * 71 + hud.x, GAME_HUD_WIDTH); };
+
+    scene.show_metrics = true;
+    draw_frame(renderer, scene, game);
+    EXPECT_EQ(row(0), L"us       p50   p99   max");
+    EXPECT_EQ(row(1).substr(0, 7), L"input  ");
+
+    scene.show_metrics = false;
+    draw_frame(renderer, scene, game);
+    EXPECT_EQ(row(0), std::wstring(GAME_HUD_WIDTH, L' '));
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include "replay.h"
+
+// --- Helpers ---
+
+// Play random inputs with gravity, recording every action that changed the game
+static Game record_game(const std::string &path, const std::uint64_t seed, const int steps) {
+    std::mt19937                       rng(static_cast<unsigned int>(seed));
+    std::uniform_int_distribution<int> input(0, 7);
+
+    Game game;
+    game.init(seed);
+
+    ReplayWriter writer;
+    writer.open(path, seed);
+    for (int step = 0; step < steps && !game.is_over(); ++step) {
+        const auto value = input(rng);
+        if (value > static_cast<int>(Action::Hold)) {
+            game.tick();
+            continue;
+        }
+
+        const auto action = static_cast<Action>(value);
+        if (game.apply(action)) { writer.record(action, game.get_ticks()); }
+    }
+    EXPECT_TRUE(writer.finish(game));
+
+    return game;
+}
+
+static std::vector<unsigned char> read_file(const std::string &path) {
+    std::vector<unsigned char> bytes;
+    if (auto *file = std::fopen(path.c_str(), "rb")) {
+        for (int byte; (byte = std::fgetc(file)) != EOF;) { bytes.push_back(static_cast<unsigned char>(byte)); }
+        std::fclose(file);
+    }
+    return bytes;
+}
+
+// --- Determinism Tests ---
+
+TEST(replay, SameSeedSameGame) {
+    Game first, second;
+    first.init(42);
+    second.init(42);
+
+    for (int i = 0; i < 200; ++i) {
+        first.apply(Action::HardDrop);
+        second.apply(Action::HardDrop);
+        ASSERT_EQ(first.get_checksum(), second.get_checksum());
+    }
+}
+
+TEST(replay, SeedChangesShapeOrder) {
+    Game first, second;
+    first.init(1);
+    second.init(2);
+
+    bool differs = false;
+    for (int i = 0; i < 14 && !differs; ++i) {
+        differs = first.get_current_shape().type != second.get_current_shape().type;
+        first.apply(Action::Hold);
+        second.apply(Action::Hold);
+        first.apply(Action::HardDrop);
+        second.apply(Action::HardDrop);
+    }
+    EXPECT_TRUE(differs);
+}
+
+// --- Recording Tests ---
+
+TEST(replay, RoundTrip) {
+    const auto path = testing::TempDir() + "round-trip.ttrp";
+
+    for (std::uint64_t seed : {1ull, 7ull, 0xDEADBEEFCAFEull}) {
+        const auto recorded = record_game(path, seed, 5000);
+        const auto replay   = Replay::load(path);
+
+        EXPECT_EQ(replay.get_seed(), seed);
+
+        Game       game;
+        const auto result = replay.play(game);
+
+        EXPECT_TRUE(result.is_valid());
+        EXPECT_EQ(result.checksum, recorded.get_checksum());
+        EXPECT_EQ(result.ticks, recorded.get_ticks());
+        EXPECT_EQ(game.get_pieces_placed(), recorded.get_pieces_placed());
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(replay, LargeTickGapsAreCompact) {
+    const auto path = testing::TempDir() + "ticks.ttrp";
+
+    Game game;
+    game.init(3);
+
+    ReplayWriter writer;
+    writer.open(path, 3);
+    for (int i = 0; i < 10000; ++i) { game.tick(); }
+    writer.finish(game);
+
+    const auto bytes = read_file(path);
+    EXPECT_LE(bytes.size(), static_cast<std::size_t>(REPLAY_HEADER_SIZE + 3 + 8));
+    EXPECT_TRUE(Replay::parse(bytes).play(game).is_valid());
+
+    std::remove(path.c_str());
+}
+
+TEST(replay, DetectsDivergence) {
+    const auto path = testing::TempDir() + "divergence.ttrp";
+    record_game(path, 11, 2000);
+
+    // Change the seed, the same inputs now play another game
+    auto bytes = read_file(path);
+    bytes[5] ^= 1;
+
+    Game game;
+    EXPECT_FALSE(Replay::parse(bytes).play(game).is_valid());
+
+    std::remove(path.c_str());
+}
+
+TEST(replay, ReportsFailedWrites) {
+    // Every write to /dev/full fails for lack of space
+    ReplayWriter writer;
+    try {
+        writer.open("/dev/full", 5);
+    } catch (const std::runtime_error &) { GTEST_SKIP() << "/dev/full is not available here"; }
+
+    Game game;
+    game.init(5);
+    for (int i = 0; i < 100; ++i) {
+        if (game.apply(Action::Rotate)) { writer.record(Action::Rotate, game.get_ticks()); }
+    }
+
+    EXPECT_FALSE(writer.finish(game));
+    EXPECT_FALSE(writer.is_open());
+}
+
+TEST(replay, RejectsMalformedFiles) {
+    EXPECT_THROW(Replay::parse({}), std::runtime_error);
+    EXPECT_THROW(Replay::parse({'T', 'T', 'R', 'X', REPLAY_VERSION, 0, 0, 0, 0, 0, 0, 0, 0}), std::runtime_error);
+    EXPECT_THROW(Replay::parse({'T', 'T', 'R', 'P', REPLAY_VERSION + 1, 0, 0, 0, 0, 0, 0, 0, 0}), std::runtime_error);
+
+    // Header without an end marker
+    EXPECT_THROW(Replay::parse({'T', 'T', 'R', 'P', REPLAY_VERSION, 0, 0, 0, 0, 0, 0, 0, 0}), std::runtime_error);
+    // End marker without a checksum
+    EXPECT_THROW(Replay::parse({'T', 'T', 'R', 'P', REPLAY_VERSION, 0, 0, 0, 0, 0, 0, 0, 0, REPLAY_END}), std::runtime_error);
+
+    EXPECT_THROW(Replay::load(testing::TempDir() + "missing.ttrp"), std::runtime_error);
+}
+
+TEST(replay, StopsAtGameOver) {
+    // Header then one event holding the given tick delta, a game recorded with these ticks could not count them
+    const auto make_replay = [](const std::uint64_t ticks, const unsigned int code) {
+        std::vector<unsigned char> bytes = {'T', 'T', 'R', 'P', REPLAY_VERSION, 0, 0, 0, 0, 0, 0, 0, 0};
+        for (auto event = ticks << REPLAY_CODE_BITS | code; true; event >>= 7) {
+            bytes.push_back(static_cast<unsigned char>(event < 0x80 ? event : (event & 0x7F) | 0x80));
+            if (event < 0x80) { break; }
+        }
+        bytes.push_back(REPLAY_END);
+        bytes.insert(bytes.end(), 8, 0);
+        return bytes;
+    };
+    EXPECT_THROW(Replay::parse(make_replay(std::uint64_t(1) << 40, REPLAY_END)), std::runtime_error);
+
+    // Gravity tops the game out long before these ticks run out: playback stops there instead of ticking on
+    for (const auto code : {static_cast<unsigned int>(REPLAY_END), static_cast<unsigned int>(Action::Left)}) {
+        Game       game;
+        const auto result = Replay::parse(make_replay(std::numeric_limits<unsigned int>::max(), code)).play(game);
+        EXPECT_TRUE(game.is_over());
+        EXPECT_TRUE(result.overrun);
+        EXPECT_FALSE(result.is_valid());
+        EXPECT_EQ(result.actions, 0u);
+    }
+}
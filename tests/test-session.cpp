@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "session.h"
+
+// --- Helpers ---
+
+// Send the greeting and the first frame of a session
+static void start(Session &session) {
+    session.consume(session.get_output().size());
+    EXPECT_TRUE(session.render());
+    session.consume(session.get_output().size());
+}
+
+static bool ends_with(const std::string_view text, const std::string_view suffix) {
+    return text.size() >= suffix.size() && text.substr(text.size() - suffix.size()) == suffix;
+}
+
+// --- Renderer Tests ---
+
+TEST(session, StreamRendererEncodesChanges) {
+    StreamRenderer renderer(Vec2(4, 2));
+
+    renderer.update();
+    renderer.draw_text(Vec2(1, 0), L"ok");
+    renderer.refresh();
+    EXPECT_EQ(renderer.get_output(), "\x1b[?2026h\x1b[1;1H\x1b[0m \x1b[0;37;40mok\x1b[0m \x1b[2;1H    \x1b[?2026l");
+
+    renderer.update();
+    renderer.draw_text(Vec2(1, 0), L"ok");
+    renderer.refresh();
+    EXPECT_EQ(renderer.get_output(), "");
+}
+
+// --- Stream Tests ---
+
+TEST(session, GreetsBeforeTheFirstFrame) {
+    Session session(42);
+
+    const auto greeting = std::string(TelnetParser::GREETING) + std::string(ANSI_SCREEN_ENTER);
+    EXPECT_EQ(session.get_output(), greeting);
+    EXPECT_TRUE(session.is_dirty());
+
+    session.consume(greeting.size());
+    ASSERT_TRUE(session.render());
+    EXPECT_FALSE(session.is_dirty());
+    EXPECT_GT(session.get_output().size(), 1000u); // A full redraw of the screen
+    EXPECT_EQ(session.get_frames(), 1u);
+}
+
+TEST(session, UnsentOutputDefersFrames) {
+    Session session(42);
+    start(session);
+
+    session.receive("\x1b[D");
+    ASSERT_TRUE(session.render());
+    const auto first = session.get_output().size();
+    ASSERT_GT(first, 0u);
+
+    // The client reads nothing: frames wait, and the state keeps moving
+    session.consume(1);
+    session.receive("\x1b[D\x1b[D");
+    session.tick();
+    EXPECT_FALSE(session.render());
+    EXPECT_FALSE(session.render());
+    EXPECT_EQ(session.get_output().size(), first - 1);
+    EXPECT_EQ(session.get_deferred_frames(), 2u);
+
+    // Once it caught up, one frame carries every change
+    session.consume(first - 1);
+    ASSERT_TRUE(session.render());
+    EXPECT_GT(session.get_output().size(), 0u);
+    EXPECT_EQ(session.get_frames(), 3u);
+}
+
+TEST(session, KeysSplitAcrossReads) {
+    Session session(42);
+    start(session);
+    const auto x = session.get_game().get_current_shape().position.x;
+
+    session.receive("\x1b");
+    session.receive("[");
+    EXPECT_EQ(session.get_game().get_current_shape().position.x, x);
+    session.receive("D");
+    EXPECT_EQ(session.get_game().get_current_shape().position.x, x - 1);
+    EXPECT_TRUE(session.is_dirty());
+}
+
+TEST(session, WindowSizeIsClamped) {
+    Session session(42);
+    start(session);
+    EXPECT_EQ(session.get_screen_size(), Vec2(SERVER_SCREEN_WIDTH, SERVER_SCREEN_HEIGHT));
+
+    const unsigned char naws[] = {TELNET_IAC, TELNET_SB, TELNET_OPTION_NAWS, 0x03, 0xe8, 0x00, 0x1e, TELNET_IAC, TELNET_SE};
+    session.receive(std::string_view(reinterpret_cast<const char *>(naws), sizeof(naws)));
+
+    EXPECT_EQ(session.get_screen_size(), Vec2(SERVER_SCREEN_MAX_WIDTH, 30));
+    EXPECT_TRUE(session.is_dirty());
+}
+
+// --- Lifecycle Tests ---
+
+TEST(session, QuitLeavesTheScreen) {
+    Session session(42);
+    start(session);
+
+    session.receive("q ");
+    EXPECT_TRUE(session.is_closed());
+    EXPECT_TRUE(ends_with(session.get_output(), ANSI_SCREEN_LEAVE));
+}
+
+TEST(session, GameOverStartsANewGame) {
+    Session session(42);
+    start(session);
+    EXPECT_EQ(session.get_games(), 1u);
+
+    for (int i = 0; i < 200 && session.get_games() == 1; ++i) { session.receive(" "); }
+    EXPECT_EQ(session.get_games(), 2u);
+    EXPECT_FALSE(session.get_game().is_over());
+}
+
+TEST(session, UnreadRepliesOverflow) {
+    Session session(42);
+    start(session);
+
+    // A client asking for options without ever reading the refusals
+    std::string requests;
+    for (std::size_t i = 0; i * 3 <= SERVER_OUTPUT_LIMIT; ++i) { requests += "\xff\xfd\x05"; }
+    session.receive(requests);
+    EXPECT_TRUE(session.is_overflowing());
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "board-matrix.h"
+#include "shape.h"
+
+// --- Helpers ---
+
+static BoardMatrix<unsigned char> to_matrix(const ShapeRotation &rotation) {
+    BoardMatrix<unsigned char> matrix(rotation.size.x, rotation.size.y);
+    for (int y = 0; y < rotation.size.y; ++y) { for (int x = 0; x < rotation.size.x; ++x) { matrix(x, y) = rotation.blocks[y][x]; } }
+    return matrix;
+}
+
+// --- Main Tests ---
+
+TEST(shape, Initialization) {
+    const Shape shape(5);
+
+    EXPECT_TRUE(shape.is_valid());
+    EXPECT_EQ(shape.type, 5);
+    EXPECT_EQ(shape.rotation, 0);
+    EXPECT_EQ(shape.get_size(), Vec2(3, 2));
+    EXPECT_EQ(shape.get_block(1, 1), 6);
+    EXPECT_EQ(shape.get_block(0, 1), 0);
+}
+
+TEST(shape, Empty) {
+    const Shape shape;
+
+    EXPECT_FALSE(shape.is_valid());
+    EXPECT_EQ(shape.get_size(), Vec2(0, 0));
+
+    // Every accessor reads the empty rotation state instead of indexing past the table
+    EXPECT_EQ(&shape.get_rotation(), &Shape::EMPTY_ROTATION);
+    EXPECT_EQ(shape.get_mask(), ShapeMask{});
+    EXPECT_EQ(shape.get_block(0, 0), 0);
+    EXPECT_EQ(shape.rotated_clockwise().get_block(3, 3), 0);
+}
+
+TEST(shape, InvalidIndex) { EXPECT_THROW(Shape{SHAPE_COUNT}, std::out_of_range); }
+
+TEST(shape, SpawnPosition) {
+    EXPECT_EQ(Shape(0).get_spawn_position(), Vec2(GAME_GRID_WIDTH / 2 - 2, 0));
+    EXPECT_EQ(Shape(0).rotated_clockwise().get_spawn_position(), Vec2(GAME_GRID_WIDTH / 2, 0));
+    EXPECT_EQ(Shape(3).get_spawn_position(), Vec2(GAME_GRID_WIDTH / 2 - 1, 0));
+}
+
+// --- Rotation Tests ---
+
+TEST(shape, RotationsMatchMatrixRotation) {
+    for (int type = 0; type < SHAPE_COUNT; ++type) {
+        auto expected = to_matrix(Shape::ROTATIONS[type][0]);
+
+        for (int rotation = 0; rotation < SHAPE_ROTATIONS; ++rotation) {
+            const auto &state = Shape::ROTATIONS[type][rotation];
+
+            ASSERT_EQ(state.size, Vec2(expected.get_width(), expected.get_height()));
+            for (int y = 0; y < state.size.y; ++y) { for (int x = 0; x < state.size.x; ++x) { EXPECT_EQ(state.blocks[y][x], expected(x, y)); } }
+
+            const auto mask = Bitboard::mask_of(expected);
+            for (int y = 0; y < BITBOARD_SHAPE_ROWS; ++y) { EXPECT_EQ(state.mask[y], mask[y]); }
+
+            expected = expected.rotate_clockwise();
+        }
+    }
+}
+
+TEST(shape, RotationWrapsAround) {
+    Shape shape(6);
+    for (int i = 0; i < SHAPE_ROTATIONS; ++i) { shape = shape.rotated_clockwise(); }
+
+    EXPECT_EQ(shape.rotation, 0);
+}
+
+TEST(shape, TriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable_v<Shape>);
+
+    Shape original(2);
+    original.position = Vec2(3, 4);
+    original          = original.rotated_clockwise();
+
+    const Shape copy = original;
+    EXPECT_EQ(copy.type, 2);
+    EXPECT_EQ(copy.rotation, 1);
+    EXPECT_EQ(copy.position, Vec2(3, 4));
+}
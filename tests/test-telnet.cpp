@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "telnet.h"
+
+// --- Helpers ---
+
+static std::string bytes(std::initializer_list<unsigned char> values) { return std::string(values.begin(), values.end()); }
+
+// --- Stream Tests ---
+
+TEST(telnet, PlainBytesAreData) {
+    TelnetParser parser;
+    std::string  data, replies;
+
+    parser.feed("ab\x1b[A", data, replies);
+    EXPECT_EQ(data, "ab\x1b[A");
+    EXPECT_EQ(replies, "");
+    EXPECT_EQ(parser.get_window(), Vec2());
+}
+
+TEST(telnet, StripsCommands) {
+    TelnetParser parser;
+    std::string  data, replies;
+
+    // A doubled IAC is a data byte 255, NUL pads a carriage return, a lone command is dropped
+    parser.feed(bytes({'a', TELNET_IAC, TELNET_IAC, '\r', 0, TELNET_IAC, 241, 'b'}), data, replies);
+    EXPECT_EQ(data, bytes({'a', 255, '\r', 'b'}));
+}
+
+TEST(telnet, CommandsSplitAcrossReads) {
+    TelnetParser parser;
+    std::string  data, replies;
+
+    const auto stream = bytes({'x', TELNET_IAC, TELNET_SB, TELNET_OPTION_NAWS, 0, 100, 0, 40, TELNET_IAC, TELNET_SE, 'y'});
+    for (const char c : stream) { parser.feed(std::string_view(&c, 1), data, replies); }
+
+    EXPECT_EQ(data, "xy");
+    EXPECT_EQ(parser.get_window(), Vec2(100, 40));
+}
+
+// --- Negotiation Tests ---
+
+TEST(telnet, RefusesUnknownOptions) {
+    TelnetParser parser;
+    std::string  data, replies;
+
+    // The answers to the greeting need no reply, anything else is turned down once
+    parser.feed(bytes({TELNET_IAC, TELNET_DO, TELNET_OPTION_ECHO, TELNET_IAC, TELNET_DO, TELNET_OPTION_SGA,
+                       TELNET_IAC, TELNET_WILL, TELNET_OPTION_NAWS, TELNET_IAC, TELNET_WILL, 24, TELNET_IAC, TELNET_DO, 5,
+                       TELNET_IAC, TELNET_WONT, 24, TELNET_IAC, TELNET_DONT, 5}),
+                data, replies);
+
+    EXPECT_EQ(data, "");
+    EXPECT_EQ(replies, bytes({TELNET_IAC, TELNET_DONT, 24, TELNET_IAC, TELNET_WONT, 5}));
+}
+
+TEST(telnet, WindowSizeWithEscapedBytes) {
+    TelnetParser parser;
+    std::string  data, replies;
+
+    // A size byte of 255 is doubled inside the subnegotiation
+    parser.feed(bytes({TELNET_IAC, TELNET_SB, TELNET_OPTION_NAWS, 0, TELNET_IAC, TELNET_IAC, 1, 0, TELNET_IAC, TELNET_SE}), data, replies);
+    EXPECT_EQ(parser.get_window(), Vec2(255, 256));
+}
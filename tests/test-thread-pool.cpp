@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "thread-pool.h"
+
+// --- Scheduling Tests ---
+
+TEST(thread_pool, RunsEveryTask) {
+    ThreadPool       pool(4);
+    std::vector<int> done(1000, 0);
+
+    for (int i = 0; i < 1000; ++i) {
+        pool.submit([&done, i] { done[i] = i; });
+    }
+    pool.wait();
+
+    for (int i = 0; i < 1000; ++i) { EXPECT_EQ(done[i], i); }
+}
+
+TEST(thread_pool, WaitsForNestedTasks) {
+    ThreadPool       pool(3);
+    std::atomic<int> count = 0;
+
+    for (int i = 0; i < 10; ++i) {
+        pool.submit([&pool, &count] {
+            for (int j = 0; j < 10; ++j) {
+                pool.submit([&count] { ++count; });
+            }
+        });
+    }
+    pool.wait();
+
+    EXPECT_EQ(count, 100);
+}
+
+TEST(thread_pool, ReusableAfterWait) {
+    ThreadPool       pool(2);
+    std::atomic<int> count = 0;
+
+    for (int round = 1; round <= 3; ++round) {
+        for (int i = 0; i < 50; ++i) { pool.submit([&count] { ++count; }); }
+        pool.wait();
+        EXPECT_EQ(count, round * 50);
+    }
+}
+
+TEST(thread_pool, StealsFromBusyWorkers) {
+    ThreadPool       pool(2);
+    std::atomic<int> count = 0;
+
+    // One worker queues every task behind a long one, the other must steal them
+    pool.submit([&pool, &count] {
+        for (int i = 0; i < 20; ++i) { pool.submit([&count] { ++count; }); }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+    pool.wait();
+
+    EXPECT_EQ(count, 20);
+    EXPECT_GT(pool.get_steals(), 0u);
+}
+
+TEST(thread_pool, FinishesQueuedTasksOnDestruction) {
+    std::atomic<int> count = 0;
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 100; ++i) { pool.submit([&count] { ++count; }); }
+    }
+    EXPECT_EQ(count, 100);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "transposition-table.h"
+
+// --- Lookup Tests ---
+
+TEST(transposition_table, StoreAndProbe) {
+    TranspositionTable table(4);
+    TranspositionEntry entry;
+
+    EXPECT_FALSE(table.probe(42, entry));
+
+    table.store(42, TranspositionEntry{1.5f, 3});
+    ASSERT_TRUE(table.probe(42, entry));
+    EXPECT_EQ(entry.score, 1.5f);
+    EXPECT_EQ(entry.depth, 3);
+
+    EXPECT_EQ(table.get_probes(), 2u);
+    EXPECT_EQ(table.get_hits(), 1u);
+    EXPECT_DOUBLE_EQ(table.get_hit_rate(), 0.5);
+}
+
+TEST(transposition_table, OverwritesSameKey) {
+    TranspositionTable table(4);
+    TranspositionEntry entry;
+
+    table.store(7, TranspositionEntry{1.0f, 1});
+    table.store(7, TranspositionEntry{2.0f, 0});
+
+    ASSERT_TRUE(table.probe(7, entry));
+    EXPECT_EQ(entry.score, 2.0f);
+}
+
+// --- Replacement Tests ---
+
+TEST(transposition_table, ReplacesShallowestEntry) {
+    TranspositionTable table(0); // A single cluster
+    TranspositionEntry entry;
+
+    for (std::uint64_t key = 1; key <= TranspositionTable::CLUSTER_SIZE; ++key) { table.store(key, TranspositionEntry{0.0f, static_cast<unsigned char>(key == 2 ? 0 : 5)}); }
+    table.store(100, TranspositionEntry{0.0f, 5});
+
+    EXPECT_FALSE(table.probe(2, entry));
+    EXPECT_TRUE(table.probe(1, entry));
+    EXPECT_TRUE(table.probe(100, entry));
+}
+
+TEST(transposition_table, ReplacesOldEntriesFirst) {
+    TranspositionTable table(0);
+    TranspositionEntry entry;
+
+    table.store(1, TranspositionEntry{0.0f, 2});
+    table.new_search();
+    for (std::uint64_t key = 2; key <= TranspositionTable::CLUSTER_SIZE; ++key) { table.store(key, TranspositionEntry{0.0f, 2}); }
+    table.store(100, TranspositionEntry{0.0f, 2});
+
+    EXPECT_FALSE(table.probe(1, entry));
+    EXPECT_TRUE(table.probe(100, entry));
+}
+
+TEST(transposition_table, Clear) {
+    TranspositionTable table(4);
+    TranspositionEntry entry;
+
+    table.store(9, TranspositionEntry{1.0f, 1});
+    table.clear();
+
+    EXPECT_FALSE(table.probe(9, entry));
+    EXPECT_EQ(table.get_stores(), 0u);
+}
+
+// --- Concurrency Tests ---
+
+TEST(transposition_table, ConcurrentAccessNeverReturnsForeignEntries) {
+    TranspositionTable table(2); // Small, so threads keep overwriting each other
+
+    // Every key maps to one score, a hit with another score would be a torn slot
+    const auto score_of = [](const std::uint64_t key) { return static_cast<float>(key % 1000); };
+
+    std::atomic<bool>        corrupted = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (std::uint64_t i = 0; i < 20000; ++i) {
+                const auto key = (i * 4 + t) * 0x9E3779B97F4A7C15ull;
+                table.store(key, TranspositionEntry{score_of(key), 1});
+
+                TranspositionEntry entry;
+                const auto         probed = key ^ 0x5555;
+                if (table.probe(probed, entry) && entry.score != score_of(probed)) { corrupted = true; }
+                if (table.probe(key, entry) && entry.score != score_of(key)) { corrupted = true; }
+            }
+        });
+    }
+    for (auto &thread : threads) { thread.join(); }
+
+    EXPECT_FALSE(corrupted);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "bot.h"
+#include "game.h"
+#include "zobrist.h"
+
+// --- Key Tests ---
+
+TEST(zobrist, KeysAreDistinct) {
+    std::vector<std::uint64_t> keys;
+    for (const auto &row : ZOBRIST.cells) { keys.insert(keys.end(), std::begin(row), std::end(row)); }
+    keys.insert(keys.end(), std::begin(ZOBRIST.current), std::end(ZOBRIST.current));
+    keys.insert(keys.end(), std::begin(ZOBRIST.held), std::end(ZOBRIST.held));
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(std::adjacent_find(keys.begin(), keys.end()), keys.end());
+}
+
+TEST(zobrist, BoardHash) {
+    Bitboard board;
+    EXPECT_EQ(zobrist_board(board), 0u);
+
+    board.set(3, 7);
+    board.set(9, 19);
+    EXPECT_EQ(zobrist_board(board), ZOBRIST.cells[7][3] ^ ZOBRIST.cells[19][9]);
+}
+
+// --- Game Hash Tests ---
+
+TEST(zobrist, IncrementalMatchesRecomputed) {
+    std::mt19937                       rng(31);
+    std::uniform_int_distribution<int> input(0, 5);
+
+    Game game;
+    game.init(31);
+    for (int step = 0; step < 5000 && !game.is_over(); ++step) {
+        game.apply(static_cast<Action>(input(rng)));
+        ASSERT_EQ(game.get_board_hash(), zobrist_board(game.get_occupancy())) << "step " << step;
+    }
+}
+
+TEST(zobrist, IncrementalMatchesRecomputedThroughLineClears) {
+    Game game;
+    game.init(31);
+
+    Bot bot;
+    for (int piece = 0; piece < 300 && bot.play(game); ++piece) { ASSERT_EQ(game.get_board_hash(), zobrist_board(game.get_occupancy())) << "piece " << piece; }
+    EXPECT_GT(game.get_lines_cleared(), 0u);
+}
+
+TEST(zobrist, SameStateThroughDifferentMoves) {
+    Game first, second;
+    first.init(8);
+    second.init(8);
+
+    first.apply(Action::Left);
+    first.apply(Action::Rotate);
+    second.apply(Action::Rotate);
+    second.apply(Action::Left);
+    first.apply(Action::HardDrop);
+    second.apply(Action::HardDrop);
+
+    EXPECT_EQ(first.get_hash(), second.get_hash());
+}
+
+TEST(zobrist, HashCoversShapesAndBag) {
+    Game game;
+    game.init(4);
+
+    const auto initial = game.get_hash();
+
+    auto held = game;
+    held.apply(Action::Hold);
+    EXPECT_NE(held.get_hash(), initial);
+
+    // Moving the current shape does not change the hashed state
+    auto moved = game;
+    moved.apply(Action::Left);
+    EXPECT_EQ(moved.get_hash(), initial);
+}